@@ -0,0 +1,248 @@
+#pragma once
+
+#include "hash_table.h"
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
+/**
+ * @class ConcurrentHashMap
+ * @brief A thread-safe hash map built from independently locked HashMap shards.
+ *
+ * Keys are split across a power-of-two number of shards by their hash, and each
+ * shard is a HashMap guarded by its own reader/writer lock. Readers of one shard
+ * never block each other, and operations on different shards never contend, so
+ * throughput grows with the number of cores instead of serializing on a single
+ * global mutex.
+ *
+ * @tparam Key The type of keys stored in the hash map.
+ * @tparam Value The type of mapped values.
+ * @tparam Hash The hash function type, defaults to std::hash<Key>.
+ * @tparam Policy Compile-time options of the underlying HashMap shards.
+ *
+ * Key features:
+ * - Shared (read) locking for lookups, exclusive locking for updates, per shard
+ * - Shards padded to separate cache lines to avoid false sharing between locks
+ * - Callback-based lookup so no reference escapes the lock
+ * - Shard visitor for bulk reads and maintenance
+ *
+ * Usage example:
+ * @code
+ * userDefineDataStructure::ConcurrentHashMap<std::string, int> counters;
+ * counters.insert_or_assign("requests", 1);
+ *
+ * counters.find("requests", [](const int &value) {
+ *     std::cout << value << std::endl;
+ * });
+ * @endcode
+ *
+ * @note Values are only ever accessed inside callbacks that run while the shard
+ *       lock is held; callbacks must not call back into the same map.
+ */
+
+namespace userDefineDataStructure {
+    template<typename Key, typename Value, typename Hash = std::hash<Key>, typename Policy = HashMapPolicy>
+    class ConcurrentHashMap {
+    public:
+        using map_type = HashMap<Key, Value, Hash, Policy>;///< Type of a single shard's map
+
+    private:
+        /**
+        * @brief One independently locked part of the map.
+        *
+        * Aligned to a cache line so that taking one shard's lock does not
+        * invalidate the line holding its neighbour's lock.
+        */
+        struct alignas(64) Shard {
+            mutable std::shared_mutex mutex;///< Guards map
+            map_type map;                   ///< Entries whose hash selects this shard
+        };
+
+        std::unique_ptr<Shard[]> shards;///< Array of shard_count_ shards
+        size_t shard_count_;            ///< Number of shards, a power of two
+        Hash hasher;                    ///< Hash function object used to pick a shard
+
+        /**
+        * @brief Selects the shard responsible for a key.
+        *
+        * Uses the top bits of a multiplicative hash with a different constant than
+        * PowerOfTwoBucketPolicy, so the bits that pick the shard are not the same
+        * bits that later pick a bucket inside it.
+        *
+        * @param key The key to route.
+        * @return Shard& The shard that holds the key.
+        */
+        Shard &shard_for(const Key &key) const {
+            uint64_t h = static_cast<uint64_t>(hasher(key)) * 0xC2B2AE3D27D4EB4Full;
+            size_t index = static_cast<size_t>(std::rotl(h, std::countr_zero(shard_count_))) & (shard_count_ - 1);
+            return shards[index];
+        }
+
+    public:
+        /**
+        * @brief Returns the default number of shards for this machine.
+        *
+        * Four shards per hardware thread keeps the chance of two threads hitting
+        * the same shard low.
+        *
+        * @return size_t A power-of-two shard count.
+        */
+        static size_t default_shard_count() {
+            size_t threads = std::thread::hardware_concurrency();
+            return std::bit_ceil(4 * (threads ? threads : 1));
+        }
+
+        /**
+        * @brief Constructs a new ConcurrentHashMap object.
+        *
+        * @param shard_count Number of shards, rounded up to a power of two.
+        * @param hash Hash function object (default is Hash()).
+        */
+        explicit ConcurrentHashMap(size_t shard_count = default_shard_count(), const Hash &hash = Hash())
+            : shard_count_(std::bit_ceil(shard_count ? shard_count : 1)), hasher(hash) {
+            shards = std::make_unique<Shard[]>(shard_count_);
+        }
+
+        ConcurrentHashMap(const ConcurrentHashMap &) = delete;
+        ConcurrentHashMap &operator=(const ConcurrentHashMap &) = delete;
+
+        /**
+        * @brief Inserts a new element or assigns to an existing element.
+        *
+        * @param key The key of the element to insert or assign.
+        * @param value The value to be inserted or assigned.
+        * @return true If a new element was inserted.
+        * @return false If an existing element was assigned.
+        *
+        * Time Complexity: Amortized O(1) on average.
+        */
+        bool insert_or_assign(const Key &key, const Value &value) {
+            Shard &shard = shard_for(key);
+            std::unique_lock lock(shard.mutex);
+            size_t before = shard.map.size();
+            shard.map.insert_or_assign(key, value);
+            return shard.map.size() != before;
+        }
+
+        /**
+        * @brief Looks up a key and passes its value to a callback.
+        *
+        * The callback runs under the shard's shared lock, so other readers of the
+        * shard proceed concurrently while writers wait.
+        *
+        * @tparam F Callable as f(const Value &).
+        * @param key The key to search for.
+        * @param callback Invoked with the value if the key is present.
+        * @return true If the key was found and the callback invoked.
+        *
+        * Time Complexity: O(1) on average.
+        */
+        template<typename F>
+        bool find(const Key &key, F &&callback) const {
+            const Shard &shard = shard_for(key);
+            std::shared_lock lock(shard.mutex);
+            auto it = shard.map.find(key);
+            if (it == shard.map.end())
+                return false;
+            std::invoke(std::forward<F>(callback), it->second);
+            return true;
+        }
+
+        /**
+        * @brief Checks if the container contains an element with the specified key.
+        *
+        * @param key The key to search for.
+        * @return true If an element with the key exists.
+        *
+        * Time Complexity: O(1) on average.
+        */
+        bool contains(const Key &key) const {
+            const Shard &shard = shard_for(key);
+            std::shared_lock lock(shard.mutex);
+            return shard.map.contains(key);
+        }
+
+        /**
+        * @brief Removes an element with the specified key.
+        *
+        * @param key The key of the element to remove.
+        * @return true If an element was found and removed.
+        *
+        * Time Complexity: O(1) on average.
+        */
+        bool erase(const Key &key) {
+            Shard &shard = shard_for(key);
+            std::unique_lock lock(shard.mutex);
+            return shard.map.erase(key);
+        }
+
+        /**
+        * @brief Visits every shard while holding its exclusive lock.
+        *
+        * Shards are locked one at a time, so the visitor sees a consistent view of
+        * each shard but not of the map as a whole.
+        *
+        * @tparam F Callable as f(map_type &).
+        * @param visitor Invoked once per shard.
+        *
+        * Time Complexity: O(n) plus the cost of the visitor.
+        */
+        template<typename F>
+        void for_each_shard(F &&visitor) {
+            for (size_t i = 0; i < shard_count_; ++i) {
+                std::unique_lock lock(shards[i].mutex);
+                std::invoke(visitor, shards[i].map);
+            }
+        }
+
+        /**
+        * @brief Returns the number of elements in the container.
+        *
+        * Shards are counted one after another, so under concurrent updates the
+        * result is only a snapshot.
+        *
+        * @return size_t The number of elements.
+        *
+        * Time Complexity: O(s), where s is the number of shards.
+        */
+        size_t size() const {
+            size_t total = 0;
+            for (size_t i = 0; i < shard_count_; ++i) {
+                std::shared_lock lock(shards[i].mutex);
+                total += shards[i].map.size();
+            }
+            return total;
+        }
+
+        /**
+        * @brief Checks if the container is empty.
+        *
+        * @return true If no shard holds an element.
+        */
+        bool empty() const { return size() == 0; }
+
+        /**
+        * @brief Removes all elements from the container.
+        *
+        * Time Complexity: O(n), where n is the number of elements.
+        */
+        void clear() {
+            for (size_t i = 0; i < shard_count_; ++i) {
+                std::unique_lock lock(shards[i].mutex);
+                shards[i].map.clear();
+            }
+        }
+
+        /**
+        * @brief Returns the number of shards.
+        *
+        * @return size_t The shard count.
+        */
+        size_t shard_count() const { return shard_count_; }
+    };
+
+}// namespace userDefineDataStructure
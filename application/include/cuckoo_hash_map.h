@@ -0,0 +1,475 @@
+#pragma once
+
+#include "vector.h"
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+
+/**
+ * @class CuckooHashMap
+ * @brief A concurrent bucketized cuckoo hash map whose readers never write shared memory.
+ *
+ * Every key has two candidate buckets of four slots each. Lookups check both
+ * buckets optimistically: they read each bucket's version counter, copy out the
+ * slots, and retry only if a writer changed either bucket in the meantime
+ * (a seqlock). Readers therefore take no lock and dirty no cache line, so read
+ * throughput scales with the number of cores even on a single hot table.
+ *
+ * Writers are serialized by one mutex. An insert into two full buckets finds a
+ * short chain of displacements by breadth-first search and moves those entries
+ * one by one, each move bumping the versions of both buckets it touches; the
+ * table doubles only when no such chain exists.
+ *
+ * @tparam Key The type of keys; must be trivially copyable and default constructible.
+ * @tparam Value The type of mapped values; must be trivially copyable and default constructible.
+ * @tparam Hash The hash function type, defaults to std::hash<Key>. Both candidate
+ *              buckets are derived from a single hash value.
+ *
+ * Key features:
+ * - Lock-free, write-free lookups (optimistic, version-validated)
+ * - 4-way buckets with 8-bit tags, reaching load factors above 90%
+ * - Bounded breadth-first displacement instead of random-walk eviction
+ *
+ * Usage example:
+ * @code
+ * userDefineDataStructure::CuckooHashMap<uint64_t, double> prices;
+ * prices.insert_or_assign(42, 9.99);
+ *
+ * if (auto price = prices.find(42))
+ *     std::cout << *price << std::endl;
+ * @endcode
+ *
+ * @note Keys and values are copied in and out as raw 64-bit words, which is why
+ *       they must be trivially copyable. A reader may briefly see a torn key
+ *       before discarding it, so Key's operator== must not follow pointers.
+ *       Arrays replaced by growth are kept until the map is destroyed, because
+ *       a lock-free reader may still be using them; call reserve() up front to
+ *       avoid growth.
+ */
+
+namespace userDefineDataStructure {
+    template<typename Key, typename Value, typename Hash = std::hash<Key>>
+    class CuckooHashMap {
+        static_assert(std::is_trivially_copyable_v<Key> && std::is_default_constructible_v<Key>,
+                      "CuckooHashMap keys must be trivially copyable and default constructible");
+        static_assert(std::is_trivially_copyable_v<Value> && std::is_default_constructible_v<Value>,
+                      "CuckooHashMap values must be trivially copyable and default constructible");
+
+    private:
+        static constexpr size_t kSlotsPerBucket = 4;          ///< Entries per bucket
+        static constexpr size_t kMaxSearch = 512;             ///< Buckets visited when looking for a displacement chain
+        static constexpr size_t kKeyWords = (sizeof(Key) + 7) / 8;  ///< 64-bit words per stored key
+        static constexpr size_t kValueWords = (sizeof(Value) + 7) / 8;///< 64-bit words per stored value
+
+        /**
+        * @brief Copies a trivially copyable object into atomic words.
+        */
+        template<typename T, size_t Words>
+        static void store_words(std::atomic<uint64_t> (&dst)[Words], const T &value) {
+            uint64_t buffer[Words] = {};
+            std::memcpy(buffer, &value, sizeof(T));
+            for (size_t i = 0; i < Words; ++i)
+                dst[i].store(buffer[i], std::memory_order_relaxed);
+        }
+
+        /**
+        * @brief Copies a trivially copyable object out of atomic words.
+        */
+        template<typename T, size_t Words>
+        static T load_words(const std::atomic<uint64_t> (&src)[Words]) {
+            uint64_t buffer[Words];
+            for (size_t i = 0; i < Words; ++i)
+                buffer[i] = src[i].load(std::memory_order_relaxed);
+            T value;
+            std::memcpy(&value, buffer, sizeof(T));
+            return value;
+        }
+
+        /**
+        * @brief One key-value entry, stored as atomic words so racing reads are well defined.
+        */
+        struct Slot {
+            std::atomic<uint64_t> key[kKeyWords];
+            std::atomic<uint64_t> value[kValueWords];
+        };
+
+        /**
+        * @brief A group of slots guarded by a version counter.
+        *
+        * The version is odd while a writer is modifying the bucket. A tag of 0
+        * marks an empty slot; otherwise it holds 8 bits of the key's hash.
+        */
+        struct Bucket {
+            std::atomic<uint64_t> version{0};
+            std::atomic<uint8_t> tags[kSlotsPerBucket] = {};
+            Slot slots[kSlotsPerBucket];
+        };
+
+        /**
+        * @brief A bucket array; replaced as a whole when the map grows.
+        */
+        struct Table {
+            std::unique_ptr<Bucket[]> buckets;
+            size_t mask;
+
+            explicit Table(size_t bucket_count)
+                : buckets(std::make_unique<Bucket[]>(bucket_count)), mask(bucket_count - 1) {}
+        };
+
+        /**
+        * @brief One visited bucket of the displacement search.
+        */
+        struct SearchNode {
+            size_t bucket;///< Bucket reached
+            size_t slot;  ///< Slot of the parent bucket whose entry would move here
+            size_t parent;///< Index of the parent node, or npos for a start bucket
+        };
+
+        static constexpr size_t npos = static_cast<size_t>(-1);
+
+        std::atomic<Table *> table;              ///< Current table, read by lock-free lookups
+        vector<std::unique_ptr<Table>> tables;   ///< Current and retired tables, owned until destruction
+        std::atomic<size_t> size_;               ///< Number of entries
+        mutable std::mutex write_mutex;          ///< Serializes all writers
+        Hash hasher;                             ///< Hash function object
+
+        /**
+        * @brief Scrambles the user hash so that bucket index and tag use independent, well-mixed bits.
+        */
+        static uint64_t mix(uint64_t x) {
+            x ^= x >> 33;
+            x *= 0xFF51AFD7ED558CCDull;
+            x ^= x >> 33;
+            return x;
+        }
+
+        /**
+        * @brief Returns the nonzero 8-bit tag of a mixed hash.
+        */
+        static uint8_t tag_of(uint64_t h) {
+            uint8_t tag = static_cast<uint8_t>(h >> 56);
+            return tag ? tag : 1;
+        }
+
+        /**
+        * @brief Returns a key's other bucket; applying it twice yields the original bucket.
+        */
+        static size_t alt_bucket(size_t bucket, uint8_t tag, size_t mask) {
+            return (bucket ^ (static_cast<size_t>(tag) * 0x5BD1E995u)) & mask;
+        }
+
+        static void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#else
+            std::this_thread::yield();
+#endif
+        }
+
+        /**
+        * @brief Marks a bucket as being modified; only called with write_mutex held.
+        */
+        static void begin_write(Bucket &bucket) {
+            bucket.version.store(bucket.version.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+        }
+
+        /**
+        * @brief Publishes the modifications of a bucket.
+        */
+        static void end_write(Bucket &bucket) {
+            bucket.version.store(bucket.version.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        /**
+        * @brief Looks up a slot holding a key; only called with write_mutex held.
+        *
+        * @return Pair of bucket and slot index, or bucket npos if absent.
+        */
+        std::pair<size_t, size_t> locate(const Table &t, const Key &key, uint64_t h) const {
+            uint8_t tag = tag_of(h);
+            size_t b1 = h & t.mask;
+            size_t b2 = alt_bucket(b1, tag, t.mask);
+            for (size_t b: {b1, b2}) {
+                const Bucket &bucket = t.buckets[b];
+                for (size_t s = 0; s < kSlotsPerBucket; ++s)
+                    if (bucket.tags[s].load(std::memory_order_relaxed) == tag &&
+                        load_words<Key>(bucket.slots[s].key) == key)
+                        return {b, s};
+            }
+            return {npos, 0};
+        }
+
+        /**
+        * @brief Returns a free slot of a bucket, or npos if it is full.
+        */
+        static size_t free_slot(const Bucket &bucket) {
+            for (size_t s = 0; s < kSlotsPerBucket; ++s)
+                if (bucket.tags[s].load(std::memory_order_relaxed) == 0)
+                    return s;
+            return npos;
+        }
+
+        /**
+        * @brief Makes room in one of a key's two buckets by displacing entries along a chain.
+        *
+        * Searches breadth-first from both buckets for a bucket with a free slot,
+        * then moves the entries along the found chain, last one first, so every
+        * entry stays findable in one of its buckets at all times.
+        *
+        * @return Pair of bucket and now free slot, or bucket npos if no chain was found.
+        */
+        std::pair<size_t, size_t> make_room(Table &t, size_t b1, size_t b2) {
+            vector<SearchNode> nodes;
+            nodes.push_back({b1, 0, npos});
+            nodes.push_back({b2, 0, npos});
+            for (size_t i = 0; i < nodes.size() && i < kMaxSearch; ++i) {
+                size_t free = free_slot(t.buckets[nodes[i].bucket]);
+                if (free != npos) {
+                    size_t n = i;
+                    for (; nodes[n].parent != npos; n = nodes[n].parent) {
+                        Bucket &to = t.buckets[nodes[n].bucket];
+                        Bucket &from = t.buckets[nodes[nodes[n].parent].bucket];
+                        size_t from_slot = nodes[n].slot;
+                        begin_write(to);
+                        begin_write(from);
+                        for (size_t w = 0; w < kKeyWords; ++w)
+                            to.slots[free].key[w].store(from.slots[from_slot].key[w].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                        for (size_t w = 0; w < kValueWords; ++w)
+                            to.slots[free].value[w].store(from.slots[from_slot].value[w].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                        to.tags[free].store(from.tags[from_slot].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                        from.tags[from_slot].store(0, std::memory_order_relaxed);
+                        end_write(from);
+                        end_write(to);
+                        free = from_slot;
+                    }
+                    return {nodes[n].bucket, free};
+                }
+                const Bucket &bucket = t.buckets[nodes[i].bucket];
+                for (size_t s = 0; s < kSlotsPerBucket; ++s) {
+                    size_t alt = alt_bucket(nodes[i].bucket, bucket.tags[s].load(std::memory_order_relaxed), t.mask);
+                    if (alt != nodes[i].bucket)
+                        nodes.push_back({alt, s, i});
+                }
+            }
+            return {npos, 0};
+        }
+
+        /**
+        * @brief Writes a new entry into a free slot and publishes it.
+        */
+        static void fill_slot(Bucket &bucket, size_t slot, uint8_t tag, const Key &key, const Value &value) {
+            begin_write(bucket);
+            store_words(bucket.slots[slot].key, key);
+            store_words(bucket.slots[slot].value, value);
+            bucket.tags[slot].store(tag, std::memory_order_relaxed);
+            end_write(bucket);
+        }
+
+        /**
+        * @brief Places a key known to be absent; only called with write_mutex held.
+        *
+        * @return true If a slot was found without growing.
+        */
+        bool place(Table &t, const Key &key, const Value &value, uint64_t h) {
+            uint8_t tag = tag_of(h);
+            size_t b1 = h & t.mask;
+            size_t b2 = alt_bucket(b1, tag, t.mask);
+            for (size_t b: {b1, b2}) {
+                size_t slot = free_slot(t.buckets[b]);
+                if (slot != npos) {
+                    fill_slot(t.buckets[b], slot, tag, key, value);
+                    return true;
+                }
+            }
+            auto [bucket, slot] = make_room(t, b1, b2);
+            if (bucket == npos)
+                return false;
+            fill_slot(t.buckets[bucket], slot, tag, key, value);
+            return true;
+        }
+
+        /**
+        * @brief Replaces the table by one with at least the given number of buckets.
+        *
+        * The new table is filled privately and then published; lock-free readers
+        * still holding the old table see its final contents, which no longer change.
+        */
+        void grow(size_t bucket_count) {
+            Table &old_table = *table.load(std::memory_order_relaxed);
+            for (;; bucket_count *= 2) {
+                auto fresh = std::make_unique<Table>(bucket_count);
+                bool complete = true;
+                for (size_t b = 0; b <= old_table.mask && complete; ++b) {
+                    const Bucket &bucket = old_table.buckets[b];
+                    for (size_t s = 0; s < kSlotsPerBucket && complete; ++s) {
+                        if (bucket.tags[s].load(std::memory_order_relaxed) == 0)
+                            continue;
+                        Key key = load_words<Key>(bucket.slots[s].key);
+                        complete = place(*fresh, key, load_words<Value>(bucket.slots[s].value), mix(hasher(key)));
+                    }
+                }
+                if (complete) {
+                    table.store(fresh.get(), std::memory_order_release);
+                    tables.push_back(std::move(fresh));
+                    return;
+                }
+            }
+        }
+
+    public:
+        /**
+        * @brief Constructs a new CuckooHashMap.
+        *
+        * @param initial_capacity Number of entries to make room for (default is 64).
+        * @param hash Hash function object (default is Hash()).
+        */
+        explicit CuckooHashMap(size_t initial_capacity = 64, const Hash &hash = Hash())
+            : size_(0), hasher(hash) {
+            size_t bucket_count = std::bit_ceil(std::max<size_t>(2, (initial_capacity * 10 / 9 + kSlotsPerBucket - 1) / kSlotsPerBucket));
+            tables.push_back(std::make_unique<Table>(bucket_count));
+            table.store(tables.back().get(), std::memory_order_release);
+        }
+
+        CuckooHashMap(const CuckooHashMap &) = delete;
+        CuckooHashMap &operator=(const CuckooHashMap &) = delete;
+
+        /**
+        * @brief Looks up a key without taking a lock.
+        *
+        * @param key The key to search for.
+        * @return std::optional<Value> A copy of the value, or empty if the key is absent.
+        *
+        * Time Complexity: O(1); retried if a writer modified the key's buckets meanwhile.
+        */
+        std::optional<Value> find(const Key &key) const {
+            uint64_t h = mix(hasher(key));
+            uint8_t tag = tag_of(h);
+            for (;;) {
+                const Table &t = *table.load(std::memory_order_acquire);
+                size_t b1 = h & t.mask;
+                size_t b2 = alt_bucket(b1, tag, t.mask);
+                const Bucket &first = t.buckets[b1];
+                const Bucket &second = t.buckets[b2];
+                uint64_t v1 = first.version.load(std::memory_order_acquire);
+                uint64_t v2 = second.version.load(std::memory_order_acquire);
+                if ((v1 | v2) & 1) {
+                    cpu_relax();
+                    continue;
+                }
+
+                std::optional<Value> result;
+                for (const Bucket *bucket: {&first, &second}) {
+                    for (size_t s = 0; s < kSlotsPerBucket && !result; ++s)
+                        if (bucket->tags[s].load(std::memory_order_relaxed) == tag &&
+                            load_words<Key>(bucket->slots[s].key) == key)
+                            result = load_words<Value>(bucket->slots[s].value);
+                }
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (first.version.load(std::memory_order_relaxed) == v1 &&
+                    second.version.load(std::memory_order_relaxed) == v2)
+                    return result;
+            }
+        }
+
+        /**
+        * @brief Checks if the map contains a key, without taking a lock.
+        *
+        * @param key The key to search for.
+        * @return true If the key is present.
+        */
+        bool contains(const Key &key) const { return find(key).has_value(); }
+
+        /**
+        * @brief Inserts a new element or assigns to an existing element.
+        *
+        * @param key The key of the element to insert or assign.
+        * @param value The value to be inserted or assigned.
+        * @return true If a new element was inserted.
+        * @return false If an existing element was assigned.
+        *
+        * Time Complexity: O(1) on average; amortized O(1) including growth.
+        */
+        bool insert_or_assign(const Key &key, const Value &value) {
+            std::lock_guard lock(write_mutex);
+            uint64_t h = mix(hasher(key));
+            Table *t = table.load(std::memory_order_relaxed);
+            auto [bucket, slot] = locate(*t, key, h);
+            if (bucket != npos) {
+                Bucket &target = t->buckets[bucket];
+                begin_write(target);
+                store_words(target.slots[slot].value, value);
+                end_write(target);
+                return false;
+            }
+            while (!place(*table.load(std::memory_order_relaxed), key, value, h))
+                grow(2 * (table.load(std::memory_order_relaxed)->mask + 1));
+            size_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        /**
+        * @brief Removes an element with the specified key.
+        *
+        * @param key The key of the element to remove.
+        * @return true If an element was found and removed.
+        *
+        * Time Complexity: O(1)
+        */
+        bool erase(const Key &key) {
+            std::lock_guard lock(write_mutex);
+            Table *t = table.load(std::memory_order_relaxed);
+            auto [bucket, slot] = locate(*t, key, mix(hasher(key)));
+            if (bucket == npos)
+                return false;
+            Bucket &target = t->buckets[bucket];
+            begin_write(target);
+            target.tags[slot].store(0, std::memory_order_relaxed);
+            end_write(target);
+            size_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        /**
+        * @brief Grows the table so that it holds at least count entries without further growth.
+        *
+        * @param count Number of entries to make room for.
+        */
+        void reserve(size_t count) {
+            std::lock_guard lock(write_mutex);
+            size_t wanted = std::bit_ceil((count * 10 / 9 + kSlotsPerBucket - 1) / kSlotsPerBucket);
+            if (wanted > table.load(std::memory_order_relaxed)->mask + 1)
+                grow(wanted);
+        }
+
+        /**
+        * @brief Returns the number of elements; a snapshot under concurrent updates.
+        */
+        size_t size() const { return size_.load(std::memory_order_relaxed); }
+
+        /**
+        * @brief Checks if the map is empty.
+        */
+        bool empty() const { return size() == 0; }
+
+        /**
+        * @brief Returns the number of entry slots of the current table.
+        */
+        size_t capacity() const { return (table.load(std::memory_order_acquire)->mask + 1) * kSlotsPerBucket; }
+
+        /**
+        * @brief Returns the fraction of slots in use.
+        */
+        float load_factor() const { return static_cast<float>(size()) / static_cast<float>(capacity()); }
+    };
+
+}// namespace userDefineDataStructure
@@ -0,0 +1,687 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * @class FlatHashMap
+ * @brief An open-addressing hash table with a Swiss-table style probe.
+ *
+ * This class stores its entries directly in one contiguous slot array and keeps a
+ * parallel array of one-byte control words. Each control byte is either empty,
+ * deleted, or holds the low 7 bits of the entry's hash. Lookups load 16 control
+ * bytes at a time and compare them against the 7-bit tag in a single SIMD step,
+ * so a probe touches one cache line of metadata and, almost always, exactly one slot.
+ *
+ * @tparam Key The type of keys stored in the hash map.
+ * @tparam Value The type of mapped values.
+ * @tparam Hash The hash function type, defaults to std::hash<Key>.
+ *
+ * Key features:
+ * - Same insert_or_assign / operator[] / at / contains / erase interface as HashMap
+ * - No per-entry allocation; entries live in a flat slot array
+ * - 16-wide group probing using SSE2, with a portable fallback on other targets
+ * - Tombstone-aware growth that rehashes in place when a table is full of deletions
+ *
+ * Usage example:
+ * @code
+ * userDefineDataStructure::FlatHashMap<std::string, int> myMap;
+ * myMap.insert_or_assign("one", 1);
+ * myMap["two"] = 2;
+ *
+ * for(const auto& pair : myMap) {
+ *     std::cout << pair.first << ": " << pair.second << std::endl;
+ * }
+ * @endcode
+ *
+ * @note Unlike HashMap, any insertion may move existing entries, so references and
+ *       iterators are invalidated by every operation that can grow the table.
+ *
+ * @warning This class is not thread-safe. External synchronization is required
+ *          for concurrent access.
+ */
+
+namespace userDefineDataStructure {
+    namespace detail {
+        using ctrl_t = std::int8_t;///< Type of a single control byte
+
+        constexpr ctrl_t kEmpty = -128;  ///< Slot has never been used (0b10000000)
+        constexpr ctrl_t kDeleted = -2;  ///< Slot held an entry that was erased (0b11111110)
+        constexpr size_t kGroupWidth = 16;///< Number of control bytes examined per probe step
+
+        /**
+        * @brief A 16-bit mask with one bit per slot of a control group.
+        *
+        * Iterating the mask yields the offsets of the set bits from lowest to highest.
+        */
+        class BitMask {
+        private:
+            uint32_t mask_;
+
+        public:
+            explicit BitMask(uint32_t mask) : mask_(mask) {}
+
+            /**
+            * @brief Checks if any bit is set.
+            */
+            explicit operator bool() const { return mask_ != 0; }
+
+            /**
+            * @brief Returns the offset of the lowest set bit.
+            */
+            size_t lowest() const { return static_cast<size_t>(std::countr_zero(mask_)); }
+
+            /**
+            * @brief Clears the lowest set bit.
+            */
+            BitMask &operator++() {
+                mask_ &= mask_ - 1;
+                return *this;
+            }
+
+            size_t operator*() const { return lowest(); }
+            BitMask begin() const { return *this; }
+            BitMask end() const { return BitMask(0); }
+            bool operator!=(const BitMask &other) const { return mask_ != other.mask_; }
+        };
+
+        /**
+        * @brief A view over 16 consecutive control bytes.
+        *
+        * Uses SSE2 when the target provides it and a byte loop otherwise; both
+        * produce identical masks.
+        */
+        class Group {
+        private:
+#if defined(__SSE2__)
+            __m128i ctrl_;
+#else
+            ctrl_t ctrl_[kGroupWidth];
+#endif
+
+        public:
+            explicit Group(const ctrl_t *pos) {
+#if defined(__SSE2__)
+                ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos));
+#else
+                std::memcpy(ctrl_, pos, kGroupWidth);
+#endif
+            }
+
+            /**
+            * @brief Returns a mask of the slots whose tag equals h2.
+            */
+            BitMask match(ctrl_t h2) const {
+#if defined(__SSE2__)
+                return BitMask(static_cast<uint32_t>(
+                        _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_))));
+#else
+                uint32_t mask = 0;
+                for (size_t i = 0; i < kGroupWidth; ++i)
+                    if (ctrl_[i] == h2) mask |= 1u << i;
+                return BitMask(mask);
+#endif
+            }
+
+            /**
+            * @brief Returns a mask of the empty slots.
+            */
+            BitMask match_empty() const { return match(kEmpty); }
+
+            /**
+            * @brief Returns a mask of the slots that are empty or deleted.
+            *
+            * Both markers are negative while full slots hold a non-negative tag,
+            * so the test is a single signed compare against zero.
+            */
+            BitMask match_empty_or_deleted() const {
+#if defined(__SSE2__)
+                return BitMask(static_cast<uint32_t>(_mm_movemask_epi8(ctrl_)));
+#else
+                uint32_t mask = 0;
+                for (size_t i = 0; i < kGroupWidth; ++i)
+                    if (ctrl_[i] < 0) mask |= 1u << i;
+                return BitMask(mask);
+#endif
+            }
+        };
+    }// namespace detail
+
+    template<typename Key, typename Value, typename Hash = std::hash<Key>>
+    class FlatHashMap {
+    public:
+        using value_type = std::pair<const Key, Value>;///< Type of the stored entries
+
+    private:
+        using ctrl_t = detail::ctrl_t;
+        using SlotAlloc = std::allocator<value_type>;
+        using SlotAllocTraits = std::allocator_traits<SlotAlloc>;
+
+        std::unique_ptr<ctrl_t[]> ctrl_;///< Control bytes, one per slot
+        value_type *slots_;             ///< Slot storage, capacity_ entries
+        size_t capacity_;               ///< Number of slots (a power of two, multiple of 16)
+        size_t size_;                   ///< Number of live entries
+        size_t growth_left_;            ///< Insertions into empty slots allowed before growing
+        float max_load_factor_;         ///< Maximum load factor (capped at 7/8)
+        Hash hasher;                    ///< Hash function object
+        SlotAlloc alloc;                ///< Allocator for the slot array
+
+        /**
+        * @brief Splits a hash into the 7-bit tag stored in the control byte.
+        */
+        static ctrl_t h2(size_t hash) { return static_cast<ctrl_t>(hash & 0x7F); }
+
+        /**
+        * @brief Splits a hash into the part that selects the starting group.
+        */
+        static size_t h1(size_t hash) { return hash >> 7; }
+
+        /**
+        * @brief Hashes a key and spreads the result over all bits.
+        *
+        * std::hash is the identity for integers, which would put consecutive keys
+        * into the same group and give them nearly identical tags; a multiply-xorshift
+        * step fixes both.
+        */
+        size_t hash_of(const Key &key) const {
+            uint64_t h = static_cast<uint64_t>(hasher(key)) * 0x9E3779B97F4A7C15ull;
+            return static_cast<size_t>(h ^ (h >> 32));
+        }
+
+        /**
+        * @brief Number of entries the table may hold before it must grow.
+        */
+        size_t max_entries(size_t capacity) const {
+            float lf = max_load_factor_ < 0.875f ? max_load_factor_ : 0.875f;
+            size_t limit = static_cast<size_t>(capacity * lf);
+            return limit == 0 ? 1 : limit;
+        }
+
+        /**
+        * @brief Rounds a requested slot count up to a valid capacity.
+        */
+        static size_t normalize_capacity(size_t n) {
+            return n <= detail::kGroupWidth ? detail::kGroupWidth : std::bit_ceil(n);
+        }
+
+        /**
+        * @brief Allocates empty control and slot arrays of the given capacity.
+        */
+        void initialize(size_t capacity) {
+            ctrl_.reset(new ctrl_t[capacity]);
+            std::memset(ctrl_.get(), static_cast<unsigned char>(detail::kEmpty), capacity);
+            slots_ = SlotAllocTraits::allocate(alloc, capacity);
+            capacity_ = capacity;
+            growth_left_ = max_entries(capacity) - size_;
+        }
+
+        /**
+        * @brief Destroys all live entries and releases the slot array.
+        */
+        void destroy_slots() {
+            if (!slots_) return;
+            for (size_t i = 0; i < capacity_; ++i)
+                if (ctrl_[i] >= 0)
+                    SlotAllocTraits::destroy(alloc, slots_ + i);
+            SlotAllocTraits::deallocate(alloc, slots_, capacity_);
+            slots_ = nullptr;
+        }
+
+        /**
+        * @brief Finds the slot holding key, or capacity_ if it is absent.
+        *
+        * Groups are visited with triangular steps (1, 2, 3, ... groups), which
+        * reaches every group exactly once when the group count is a power of two.
+        */
+        size_t find_slot(const Key &key, size_t hash) const {
+            const size_t group_mask = capacity_ / detail::kGroupWidth - 1;
+            size_t group = h1(hash) & group_mask;
+            for (size_t step = 1;; ++step) {
+                size_t base = group * detail::kGroupWidth;
+                detail::Group g(ctrl_.get() + base);
+                for (size_t i: g.match(h2(hash)))
+                    if (slots_[base + i].first == key)
+                        return base + i;
+                if (g.match_empty())
+                    return capacity_;
+                group = (group + step) & group_mask;
+            }
+        }
+
+        /**
+        * @brief Finds the first empty or deleted slot on the probe sequence of hash.
+        */
+        size_t find_first_non_full(size_t hash) const {
+            const size_t group_mask = capacity_ / detail::kGroupWidth - 1;
+            size_t group = h1(hash) & group_mask;
+            for (size_t step = 1;; ++step) {
+                size_t base = group * detail::kGroupWidth;
+                detail::BitMask mask = detail::Group(ctrl_.get() + base).match_empty_or_deleted();
+                if (mask)
+                    return base + mask.lowest();
+                group = (group + step) & group_mask;
+            }
+        }
+
+        /**
+        * @brief Moves every live entry into a fresh table of new_capacity slots.
+        *
+        * @param new_capacity The new slot count (already normalized).
+        */
+        void resize(size_t new_capacity) {
+            std::unique_ptr<ctrl_t[]> old_ctrl = std::move(ctrl_);
+            value_type *old_slots = slots_;
+            size_t old_capacity = capacity_;
+
+            initialize(new_capacity);
+            for (size_t i = 0; i < old_capacity; ++i) {
+                if (old_ctrl[i] < 0) continue;
+                value_type &src = old_slots[i];
+                size_t hash = hash_of(src.first);
+                size_t target = find_first_non_full(hash);
+                ctrl_[target] = h2(hash);
+                // The source slot is destroyed right after, so its key may be moved from.
+                SlotAllocTraits::construct(alloc, slots_ + target,
+                                           std::move(const_cast<Key &>(src.first)), std::move(src.second));
+                SlotAllocTraits::destroy(alloc, &src);
+            }
+            if (old_slots)
+                SlotAllocTraits::deallocate(alloc, old_slots, old_capacity);
+            growth_left_ = max_entries(capacity_) - size_;
+        }
+
+        /**
+        * @brief Makes room for one more insertion into an empty slot.
+        *
+        * If most of the used slots are tombstones the table is rebuilt at the same
+        * capacity; otherwise it doubles.
+        */
+        void prepare_insert() {
+            if (!slots_) {
+                initialize(detail::kGroupWidth);
+                return;
+            }
+            if (growth_left_ > 0) return;
+            if (size_ * 2 <= max_entries(capacity_))
+                resize(capacity_);
+            else
+                resize(capacity_ * 2);
+        }
+
+        /**
+        * @brief Finds key, constructing its value from args when absent.
+        *
+        * @return std::pair<size_t, bool> The slot of the entry and whether it was inserted.
+        */
+        template<typename... Args>
+        std::pair<size_t, bool> find_or_insert(const Key &key, Args &&...args) {
+            size_t hash = hash_of(key);
+            if (slots_) {
+                size_t slot = find_slot(key, hash);
+                if (slot != capacity_) return {slot, false};
+            }
+            prepare_insert();
+            size_t target = find_first_non_full(hash);
+            SlotAllocTraits::construct(alloc, slots_ + target, std::piecewise_construct,
+                                       std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+            if (ctrl_[target] == detail::kEmpty) --growth_left_;
+            ctrl_[target] = h2(hash);
+            ++size_;
+            return {target, true};
+        }
+
+    public:
+        /**
+        * @brief Constructs a new FlatHashMap object.
+        *
+        * @param initial_bucket_count Initial number of slots (default is 16).
+        * @param hash Hash function object (default is Hash()).
+        */
+        explicit FlatHashMap(size_t initial_bucket_count = 16, const Hash &hash = Hash())
+            : slots_(nullptr), capacity_(0), size_(0), growth_left_(0), max_load_factor_(0.875f), hasher(hash) {
+            if (initial_bucket_count > 0)
+                initialize(normalize_capacity(initial_bucket_count));
+        }
+
+        /**
+        * @brief Copy constructs a FlatHashMap.
+        *
+        * @param other The map to copy.
+        */
+        FlatHashMap(const FlatHashMap &other)
+            : FlatHashMap(other.capacity_, other.hasher) {
+            max_load_factor_ = other.max_load_factor_;
+            for (const auto &pair: other)
+                insert_or_assign(pair.first, pair.second);
+        }
+
+        /**
+        * @brief Move constructs a FlatHashMap, leaving other empty.
+        *
+        * @param other The map to move from.
+        */
+        FlatHashMap(FlatHashMap &&other) noexcept
+            : ctrl_(std::move(other.ctrl_)), slots_(other.slots_), capacity_(other.capacity_),
+              size_(other.size_), growth_left_(other.growth_left_),
+              max_load_factor_(other.max_load_factor_), hasher(std::move(other.hasher)) {
+            other.slots_ = nullptr;
+            other.capacity_ = other.size_ = other.growth_left_ = 0;
+        }
+
+        /**
+        * @brief Copy assignment operator.
+        */
+        FlatHashMap &operator=(const FlatHashMap &other) {
+            if (this != &other) {
+                FlatHashMap temp(other);
+                swap(temp);
+            }
+            return *this;
+        }
+
+        /**
+        * @brief Move assignment operator.
+        */
+        FlatHashMap &operator=(FlatHashMap &&other) noexcept {
+            if (this != &other) {
+                FlatHashMap temp(std::move(other));
+                swap(temp);
+            }
+            return *this;
+        }
+
+        /**
+        * @brief Destroys all entries and frees the table.
+        */
+        ~FlatHashMap() {
+            destroy_slots();
+        }
+
+        /**
+        * @brief Swaps the contents of two maps.
+        */
+        void swap(FlatHashMap &other) noexcept {
+            using std::swap;
+            swap(ctrl_, other.ctrl_);
+            swap(slots_, other.slots_);
+            swap(capacity_, other.capacity_);
+            swap(size_, other.size_);
+            swap(growth_left_, other.growth_left_);
+            swap(max_load_factor_, other.max_load_factor_);
+            swap(hasher, other.hasher);
+        }
+
+        /**
+        * @brief Inserts a new element or assigns to an existing element.
+        *
+        * @param key The key of the element to insert or assign.
+        * @param value The value to be inserted or assigned.
+        *
+        * Time Complexity: Amortized O(1) on average.
+        */
+        void insert_or_assign(const Key &key, const Value &value) {
+            auto [slot, inserted] = find_or_insert(key, value);
+            if (!inserted)
+                slots_[slot].second = value;
+        }
+
+        /**
+        * @brief Accesses or inserts an element.
+        *
+        * @param key The key of the element to access or insert.
+        * @return Value& Reference to the mapped value.
+        *
+        * Time Complexity: Amortized O(1) on average.
+        */
+        Value &operator[](const Key &key) {
+            return slots_[find_or_insert(key).first].second;
+        }
+
+        /**
+        * @brief Accesses an element (const version).
+        *
+        * @param key The key of the element to access.
+        * @return const Value& Const reference to the mapped value.
+        * @throw std::out_of_range if the key is not found.
+        *
+        * Time Complexity: O(1) on average.
+        */
+        const Value &at(const Key &key) const {
+            size_t slot = slots_ ? find_slot(key, hash_of(key)) : capacity_;
+            if (slot == capacity_)
+                throw std::out_of_range("Key not found in FlatHashMap");
+            return slots_[slot].second;
+        }
+
+        /**
+        * @brief Accesses an element.
+        *
+        * @param key The key of the element to access.
+        * @return Value& Reference to the mapped value.
+        * @throw std::out_of_range if the key is not found.
+        *
+        * Time Complexity: O(1) on average.
+        */
+        Value &at(const Key &key) {
+            return const_cast<Value &>(static_cast<const FlatHashMap *>(this)->at(key));
+        }
+
+        /**
+        * @brief Checks if the container contains an element with the specified key.
+        *
+        * @param key The key to search for.
+        * @return true If an element with the key exists.
+        *
+        * Time Complexity: O(1) on average.
+        */
+        bool contains(const Key &key) const {
+            return slots_ && find_slot(key, hash_of(key)) != capacity_;
+        }
+
+        /**
+        * @brief Removes an element with the specified key.
+        *
+        * The freed slot becomes empty if its group still has an empty slot, since
+        * no probe sequence can have passed through that group; otherwise it is
+        * marked deleted so later probes keep going.
+        *
+        * @param key The key of the element to remove.
+        * @return true If an element was found and removed.
+        *
+        * Time Complexity: O(1) on average.
+        */
+        bool erase(const Key &key) {
+            if (!slots_) return false;
+            size_t slot = find_slot(key, hash_of(key));
+            if (slot == capacity_) return false;
+            SlotAllocTraits::destroy(alloc, slots_ + slot);
+            size_t base = slot & ~(detail::kGroupWidth - 1);
+            if (detail::Group(ctrl_.get() + base).match_empty()) {
+                ctrl_[slot] = detail::kEmpty;
+                ++growth_left_;
+            } else {
+                ctrl_[slot] = detail::kDeleted;
+            }
+            --size_;
+            return true;
+        }
+
+        /**
+        * @brief Removes all elements, keeping the current capacity.
+        *
+        * Time Complexity: O(n), where n is the number of slots.
+        */
+        void clear() {
+            if (!slots_) return;
+            for (size_t i = 0; i < capacity_; ++i)
+                if (ctrl_[i] >= 0)
+                    SlotAllocTraits::destroy(alloc, slots_ + i);
+            std::memset(ctrl_.get(), static_cast<unsigned char>(detail::kEmpty), capacity_);
+            size_ = 0;
+            growth_left_ = max_entries(capacity_);
+        }
+
+        /**
+        * @brief Returns the number of elements in the container.
+        */
+        size_t size() const { return size_; }
+
+        /**
+        * @brief Checks if the container is empty.
+        */
+        bool empty() const { return size_ == 0; }
+
+        /**
+        * @brief Returns the number of slots in the table.
+        */
+        size_t bucket_count() const { return capacity_; }
+
+        /**
+        * @brief Returns the current load factor of the container.
+        */
+        float load_factor() const {
+            return capacity_ ? static_cast<float>(size_) / capacity_ : 0.f;
+        }
+
+        /**
+        * @brief Sets the maximum load factor for the container.
+        *
+        * Values above 7/8 are accepted but the table never fills beyond 7/8,
+        * because longer probe sequences cost more than the memory they save.
+        *
+        * @param mlf The new maximum load factor.
+        * @throw std::invalid_argument if mlf is not positive.
+        */
+        void max_load_factor(float mlf) {
+            if (mlf <= 0.f) throw std::invalid_argument("Load factor must be positive");
+            max_load_factor_ = mlf;
+            if (slots_) rehash(capacity_);
+        }
+
+        /**
+        * @brief Returns the current maximum load factor.
+        */
+        float max_load_factor() const { return max_load_factor_; }
+
+        /**
+        * @brief Changes the number of slots and reinserts all elements.
+        *
+        * The count is raised as needed to hold the current elements within the
+        * maximum load factor and rounded up to a power of two.
+        *
+        * @param new_bucket_count The requested number of slots.
+        *
+        * Time Complexity: O(n), where n is the number of slots.
+        */
+        void rehash(size_t new_bucket_count) {
+            size_t capacity = normalize_capacity(new_bucket_count);
+            while (max_entries(capacity) < size_ + 1)
+                capacity *= 2;
+            resize(capacity);
+        }
+
+        /**
+        * @brief Reserves space for at least the specified number of elements.
+        *
+        * @param count Minimum number of elements to hold without growing.
+        */
+        void reserve(size_t count) {
+            size_t capacity = normalize_capacity(count);
+            while (max_entries(capacity) < count)
+                capacity *= 2;
+            if (capacity > capacity_)
+                resize(capacity);
+        }
+
+        /**
+        * @brief Returns the hash function object used by the container.
+        */
+        Hash hash_function() const { return hasher; }
+
+        /**
+        * @brief Forward iterator over the live slots of a FlatHashMap.
+        *
+        * @tparam Const Whether the iterator yields const entries.
+        */
+        template<bool Const>
+        class basic_iterator {
+        private:
+            using map_pointer = std::conditional_t<Const, const FlatHashMap *, FlatHashMap *>;
+            map_pointer map;
+            size_t slot;
+
+            void skip_empty() {
+                while (slot < map->capacity_ && map->ctrl_[slot] < 0)
+                    ++slot;
+            }
+
+            friend class FlatHashMap;
+            template<bool>
+            friend class basic_iterator;
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = typename FlatHashMap::value_type;
+            using difference_type = std::ptrdiff_t;
+            using reference = std::conditional_t<Const, const value_type &, value_type &>;
+            using pointer = std::conditional_t<Const, const value_type *, value_type *>;
+
+            basic_iterator(map_pointer m, size_t s) : map(m), slot(s) { skip_empty(); }
+
+            /**
+            * @brief Converts a mutable iterator into a const one.
+            */
+            template<bool C = Const, typename = std::enable_if_t<C>>
+            basic_iterator(const basic_iterator<false> &other) : map(other.map), slot(other.slot) {}
+
+            reference operator*() const { return map->slots_[slot]; }
+            pointer operator->() const { return map->slots_ + slot; }
+
+            basic_iterator &operator++() {
+                ++slot;
+                skip_empty();
+                return *this;
+            }
+
+            basic_iterator operator++(int) {
+                basic_iterator temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            bool operator==(const basic_iterator &other) const { return slot == other.slot; }
+            bool operator!=(const basic_iterator &other) const { return slot != other.slot; }
+        };
+
+        using iterator = basic_iterator<false>;     ///< Mutable iterator type
+        using const_iterator = basic_iterator<true>;///< Const iterator type
+
+        /**
+        * @brief Returns an iterator to the first element.
+        *
+        * Time Complexity: O(n) in the worst case, where n is the number of slots.
+        */
+        iterator begin() { return iterator(this, 0); }
+
+        /**
+        * @brief Returns an iterator past the last element.
+        */
+        iterator end() { return iterator(this, capacity_); }
+
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, capacity_); }
+        const_iterator cbegin() const { return begin(); }
+        const_iterator cend() const { return end(); }
+    };
+
+}// namespace userDefineDataStructure
@@ -0,0 +1,323 @@
+#pragma once
+
+#include "vector.h"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @class FrozenHashMap
+ * @brief An immutable hash map built on a minimal perfect hash function.
+ *
+ * All entries are laid out in one contiguous array with exactly as many slots as
+ * entries, and a small table of per-group seeds (about one 32-bit word per four
+ * keys) selects each key's slot without any collision. A lookup hashes the key,
+ * reads one seed and compares the key in a single slot, so every lookup, hit or
+ * miss, touches exactly one entry.
+ *
+ * The slot function follows the hash-and-displace (CHD) scheme: keys are split
+ * into groups by their hash, and groups are placed largest first, each trying
+ * seeds until all of its keys land on free slots.
+ *
+ * @tparam Key The type of keys stored in the map; must be equality comparable.
+ * @tparam Value The type of mapped values.
+ * @tparam Hash The hash function type, defaults to std::hash<Key>.
+ *
+ * Key features:
+ * - No per-entry allocation and no empty slots
+ * - One probe per lookup regardless of the key set
+ * - Built from any range of key-value pairs, or from a HashMap via HashMap::freeze()
+ *
+ * Usage example:
+ * @code
+ * userDefineDataStructure::FrozenHashMap<std::string, int> ports = {
+ *     {"http", 80}, {"https", 443}, {"ssh", 22}};
+ *
+ * std::cout << ports.at("https") << std::endl;
+ * @endcode
+ *
+ * @note Building costs expected O(n log n) time. Distinct keys must have distinct
+ *       hash values; keys that the hash function cannot tell apart are rejected.
+ */
+
+namespace userDefineDataStructure {
+    template<typename Key, typename Value, typename Hash = std::hash<Key>>
+    class FrozenHashMap {
+    public:
+        using value_type = std::pair<Key, Value>;///< Type of a stored entry
+        using const_iterator = const value_type *;///< Entries are only ever read
+
+    private:
+        static constexpr size_t kKeysPerSeed = 4;///< Average number of keys sharing a seed
+
+        vector<value_type> entries;///< Entries, indexed by their slot
+        vector<uint32_t> seeds;    ///< Seed of each group of keys
+        uint64_t salt;             ///< Perturbs the hash; changed when a build attempt fails
+        Hash hasher;               ///< Hash function object
+
+        /**
+        * @brief Scrambles all bits of a 64-bit value (the MurmurHash3 finalizer).
+        */
+        static uint64_t mix(uint64_t x) {
+            x ^= x >> 33;
+            x *= 0xFF51AFD7ED558CCDull;
+            x ^= x >> 33;
+            x *= 0xC4CEB9FE1A85EC53ull;
+            x ^= x >> 33;
+            return x;
+        }
+
+        /**
+        * @brief Returns the well-mixed hash that both the group and the slot are derived from.
+        */
+        uint64_t mixed_hash(const Key &key) const {
+            return mix(static_cast<uint64_t>(hasher(key)) ^ salt);
+        }
+
+        /**
+        * @brief Returns the group of a mixed hash.
+        */
+        size_t group_of(uint64_t h) const {
+            return static_cast<size_t>((h >> 32) % seeds.size());
+        }
+
+        /**
+        * @brief Returns the slot of a mixed hash under a given group seed.
+        */
+        static size_t slot_of(uint64_t h, uint32_t seed, size_t slot_count) {
+            return static_cast<size_t>(mix(h + (seed + 1ull) * 0x9E3779B97F4A7C15ull) % slot_count);
+        }
+
+        /**
+        * @brief Returns the only slot that could hold a key.
+        */
+        size_t slot_for(const Key &key) const {
+            uint64_t h = mixed_hash(key);
+            return slot_of(h, seeds[group_of(h)], entries.size());
+        }
+
+        /**
+        * @brief Tries to find seeds that place every key in a distinct slot.
+        *
+        * @param hashes The mixed hash of each entry.
+        * @param slots Receives the slot of each entry on success.
+        * @return true If all groups were placed within the seed budget.
+        */
+        bool place(const vector<uint64_t> &hashes, vector<size_t> &slots) {
+            const size_t n = hashes.size();
+            const size_t group_count = seeds.size();
+
+            // Counting sort of entry indices by group.
+            vector<size_t> group_start(group_count + 1);
+            for (uint64_t h: hashes)
+                ++group_start[group_of(h) + 1];
+            for (size_t g = 0; g < group_count; ++g)
+                group_start[g + 1] += group_start[g];
+            vector<size_t> members(n);
+            vector<size_t> fill(group_start);
+            for (size_t i = 0; i < n; ++i)
+                members[fill[group_of(hashes[i])]++] = i;
+
+            vector<size_t> order(group_count);
+            for (size_t g = 0; g < group_count; ++g)
+                order[g] = g;
+            std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+                return group_start[a + 1] - group_start[a] > group_start[b + 1] - group_start[b];
+            });
+
+            vector<uint8_t> taken(n);
+            vector<size_t> candidate;
+            const uint64_t budget = 64 * static_cast<uint64_t>(n) + 1024;
+            for (size_t g: order) {
+                size_t first = group_start[g], last = group_start[g + 1];
+                if (first == last)
+                    break;// Sorted by size, so every remaining group is empty.
+                for (uint64_t seed = 0;; ++seed) {
+                    if (seed == budget || seed > UINT32_MAX)
+                        return false;
+                    candidate.clear();
+                    bool fits = true;
+                    for (size_t m = first; m < last && fits; ++m) {
+                        size_t slot = slot_of(hashes[members[m]], static_cast<uint32_t>(seed), n);
+                        fits = !taken[slot] && std::find(candidate.begin(), candidate.end(), slot) == candidate.end();
+                        candidate.push_back(slot);
+                    }
+                    if (!fits)
+                        continue;
+                    for (size_t m = first; m < last; ++m) {
+                        slots[members[m]] = candidate[m - first];
+                        taken[candidate[m - first]] = 1;
+                    }
+                    seeds[g] = static_cast<uint32_t>(seed);
+                    break;
+                }
+            }
+            return true;
+        }
+
+        /**
+        * @brief Computes the perfect hash for the current entries and moves each entry to its slot.
+        *
+        * @throw std::invalid_argument if two entries have the same hash value.
+        */
+        void build() {
+            const size_t n = entries.size();
+            if (n == 0)
+                return;
+
+            vector<uint64_t> raw(n);
+            for (size_t i = 0; i < n; ++i)
+                raw[i] = static_cast<uint64_t>(hasher(entries[i].first));
+            vector<uint64_t> sorted(raw);
+            std::sort(sorted.begin(), sorted.end());
+            if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end())
+                throw std::invalid_argument("FrozenHashMap: duplicate keys or keys with equal hashes");
+
+            seeds = vector<uint32_t>((n + kKeysPerSeed - 1) / kKeysPerSeed);
+            vector<uint64_t> hashes(n);
+            vector<size_t> slots(n);
+            for (;; salt = mix(salt + 0x9E3779B97F4A7C15ull)) {
+                for (size_t i = 0; i < n; ++i)
+                    hashes[i] = mix(raw[i] ^ salt);
+                if (place(hashes, slots))
+                    break;
+            }
+
+            // Apply the permutation in place: swap each entry into its slot.
+            for (size_t i = 0; i < n; ++i) {
+                while (slots[i] != i) {
+                    size_t target = slots[i];
+                    std::swap(entries[i], entries[target]);
+                    std::swap(slots[i], slots[target]);
+                }
+            }
+        }
+
+    public:
+        /**
+        * @brief Constructs an empty FrozenHashMap.
+        */
+        FrozenHashMap() : salt(0) {}
+
+        /**
+        * @brief Builds a FrozenHashMap that takes ownership of the given entries.
+        *
+        * @param items The entries; keys must be unique.
+        * @param hash Hash function object (default is Hash()).
+        * @throw std::invalid_argument if two keys are equal or have equal hashes.
+        *
+        * Time Complexity: Expected O(n log n).
+        */
+        explicit FrozenHashMap(vector<value_type> items, const Hash &hash = Hash())
+            : entries(std::move(items)), salt(0), hasher(hash) {
+            build();
+        }
+
+        /**
+        * @brief Builds a FrozenHashMap from a range of key-value pairs.
+        *
+        * @tparam InputIt Iterator whose value type converts to value_type.
+        * @param first Beginning of the range.
+        * @param last End of the range.
+        * @param hash Hash function object (default is Hash()).
+        * @throw std::invalid_argument if two keys are equal or have equal hashes.
+        */
+        template<std::input_iterator InputIt>
+        FrozenHashMap(InputIt first, InputIt last, const Hash &hash = Hash())
+            : salt(0), hasher(hash) {
+            for (; first != last; ++first)
+                entries.push_back(value_type(*first));
+            build();
+        }
+
+        /**
+        * @brief Builds a FrozenHashMap from an initializer list.
+        *
+        * @param init The key-value pairs.
+        * @param hash Hash function object (default is Hash()).
+        * @throw std::invalid_argument if two keys are equal or have equal hashes.
+        */
+        FrozenHashMap(std::initializer_list<value_type> init, const Hash &hash = Hash())
+            : FrozenHashMap(init.begin(), init.end(), hash) {}
+
+        /**
+        * @brief Finds an element with the specified key.
+        *
+        * @param key The key to search for.
+        * @return const_iterator Pointer to the entry, or end() if the key is not present.
+        *
+        * Time Complexity: O(1), a single probe.
+        */
+        const_iterator find(const Key &key) const {
+            if (entries.empty())
+                return end();
+            const value_type &entry = entries[slot_for(key)];
+            return entry.first == key ? &entry : end();
+        }
+
+        /**
+        * @brief Checks if the map contains an element with the specified key.
+        *
+        * @param key The key to search for.
+        * @return true If an element with the key exists.
+        *
+        * Time Complexity: O(1), a single probe.
+        */
+        bool contains(const Key &key) const { return find(key) != end(); }
+
+        /**
+        * @brief Accesses an element.
+        *
+        * @param key The key of the element to access.
+        * @return const Value& Reference to the mapped value.
+        * @throw std::out_of_range if the key is not found.
+        *
+        * Time Complexity: O(1), a single probe.
+        */
+        const Value &at(const Key &key) const {
+            const_iterator it = find(key);
+            if (it == end())
+                throw std::out_of_range("Key not found in FrozenHashMap");
+            return it->second;
+        }
+
+        /**
+        * @brief Returns the number of elements.
+        */
+        size_t size() const { return entries.size(); }
+
+        /**
+        * @brief Checks if the map is empty.
+        */
+        bool empty() const { return entries.empty(); }
+
+        /**
+        * @brief Returns the number of bytes used by the slot and seed arrays.
+        *
+        * Does not include memory owned by the keys and values themselves.
+        */
+        size_t memory_usage() const {
+            return entries.size() * sizeof(value_type) + seeds.size() * sizeof(uint32_t);
+        }
+
+        /**
+        * @brief Returns the hash function object.
+        */
+        Hash hash_function() const { return hasher; }
+
+        /**
+        * @brief Returns an iterator to the first entry, in slot order.
+        */
+        const_iterator begin() const { return entries.data(); }
+
+        /**
+        * @brief Returns an iterator past the last entry.
+        */
+        const_iterator end() const { return entries.data() + entries.size(); }
+    };
+
+}// namespace userDefineDataStructure
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * @file hash.h
+ * @brief Fast non-cryptographic hash functions, usable as the Hash argument of every hashed container.
+ *
+ * std::hash is the identity for integers on libstdc++ and a byte-at-a-time
+ * loop for strings on some standard libraries. The functors here instead use
+ * one 64x64->128 bit multiply per 8 or 16 input bytes (the wyhash scheme), and
+ * fold the full product so that every input bit affects every output bit.
+ *
+ * Usage example:
+ * @code
+ * using userDefineDataStructure::FastHash;
+ * userDefineDataStructure::HashMap<std::string, int, FastHash<std::string>> counts;
+ * userDefineDataStructure::FlatHashMap<uint64_t, double, FastHash<uint64_t>> prices;
+ * @endcode
+ *
+ * @note Hash values depend on the platform's byte order and may change between
+ *       versions of this header; do not persist them. These functions are fast,
+ *       not collision resistant against an adversary who knows the seed.
+ */
+
+namespace userDefineDataStructure {
+    namespace detail {
+        constexpr uint64_t kHashSecret[4] = {0x2D358DCCAA6C78A5ull, 0x8BB84B93962EACC9ull,
+                                             0x4B33A62ED433D4A3ull, 0x4D5A2DA51DE1AA47ull};
+
+        /**
+        * @brief Multiplies two 64-bit values into their 128-bit product, low half into a, high half into b.
+        */
+        inline void multiply_128(uint64_t &a, uint64_t &b) {
+#if defined(__SIZEOF_INT128__)
+            __uint128_t product = static_cast<__uint128_t>(a) * b;
+            a = static_cast<uint64_t>(product);
+            b = static_cast<uint64_t>(product >> 64);
+#else
+            uint64_t a_hi = a >> 32, a_lo = static_cast<uint32_t>(a);
+            uint64_t b_hi = b >> 32, b_lo = static_cast<uint32_t>(b);
+            uint64_t hh = a_hi * b_hi, hl = a_hi * b_lo, lh = a_lo * b_hi, ll = a_lo * b_lo;
+            uint64_t cross = (ll >> 32) + static_cast<uint32_t>(hl) + lh;
+            a = (cross << 32) | static_cast<uint32_t>(ll);
+            b = hh + (hl >> 32) + (cross >> 32);
+#endif
+        }
+
+        /**
+        * @brief Returns the xor of the two halves of the 128-bit product of a and b.
+        */
+        inline uint64_t fold_multiply(uint64_t a, uint64_t b) {
+            multiply_128(a, b);
+            return a ^ b;
+        }
+
+        inline uint64_t read_64(const uint8_t *p) {
+            uint64_t value;
+            std::memcpy(&value, p, sizeof(value));
+            return value;
+        }
+
+        inline uint64_t read_32(const uint8_t *p) {
+            uint32_t value;
+            std::memcpy(&value, p, sizeof(value));
+            return value;
+        }
+
+        /**
+        * @brief Packs 1 to 3 bytes into one word, reading the first, middle and last byte.
+        */
+        inline uint64_t read_small(const uint8_t *p, size_t length) {
+            return (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[length >> 1]) << 8) | p[length - 1];
+        }
+    }// namespace detail
+
+    /**
+    * @brief Hashes a byte string.
+    *
+    * Reads the input 48 bytes at a time in three independent multiply chains,
+    * so long keys are hashed at several bytes per cycle; keys of up to 16 bytes
+    * take two overlapping loads and two multiplies without any loop.
+    *
+    * @param data Pointer to the bytes; may be null if length is 0.
+    * @param length Number of bytes.
+    * @param seed Value that selects a different hash function (default is 0).
+    * @return uint64_t The hash value.
+    *
+    * Time Complexity: O(length)
+    */
+    inline uint64_t hash_bytes(const void *data, size_t length, uint64_t seed = 0) {
+        using namespace detail;
+        const uint8_t *p = static_cast<const uint8_t *>(data);
+        seed ^= fold_multiply(seed ^ kHashSecret[0], kHashSecret[1]);
+        uint64_t a, b;
+        if (length <= 16) {
+            if (length >= 4) {
+                size_t offset = (length >> 3) << 2;
+                a = (read_32(p) << 32) | read_32(p + offset);
+                b = (read_32(p + length - 4) << 32) | read_32(p + length - 4 - offset);
+            } else if (length > 0) {
+                a = read_small(p, length);
+                b = 0;
+            } else {
+                a = b = 0;
+            }
+        } else {
+            size_t remaining = length;
+            if (remaining > 48) {
+                uint64_t lane1 = seed, lane2 = seed;
+                do {
+                    seed = fold_multiply(read_64(p) ^ kHashSecret[1], read_64(p + 8) ^ seed);
+                    lane1 = fold_multiply(read_64(p + 16) ^ kHashSecret[2], read_64(p + 24) ^ lane1);
+                    lane2 = fold_multiply(read_64(p + 32) ^ kHashSecret[3], read_64(p + 40) ^ lane2);
+                    p += 48;
+                    remaining -= 48;
+                } while (remaining > 48);
+                seed ^= lane1 ^ lane2;
+            }
+            while (remaining > 16) {
+                seed = fold_multiply(read_64(p) ^ kHashSecret[1], read_64(p + 8) ^ seed);
+                p += 16;
+                remaining -= 16;
+            }
+            a = read_64(p + remaining - 16);
+            b = read_64(p + remaining - 8);
+        }
+        a ^= kHashSecret[1];
+        b ^= seed;
+        multiply_128(a, b);
+        return fold_multiply(a ^ kHashSecret[0] ^ length, b ^ kHashSecret[1]);
+    }
+
+    /**
+    * @brief Scrambles a 64-bit integer so that every input bit affects every output bit.
+    *
+    * One multiply and one xor; unlike the identity std::hash, strided keys such as
+    * multiples of a power of two spread evenly over a masked table.
+    *
+    * @param value The integer to hash.
+    * @return uint64_t The hash value.
+    */
+    inline uint64_t hash_integer(uint64_t value) {
+        return detail::fold_multiply(value ^ detail::kHashSecret[0], 0x9E3779B97F4A7C15ull);
+    }
+
+    /**
+    * @brief Fast hash functor; specialized for integers, enums, pointers, floating point and strings.
+    *
+    * @tparam T The type of keys to hash.
+    */
+    template<typename T>
+    struct FastHash;
+
+    /**
+    * @brief Hashes integers, enums and pointers with hash_integer().
+    */
+    template<typename T>
+        requires(std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>)
+    struct FastHash<T> {
+        size_t operator()(T value) const {
+            if constexpr (std::is_pointer_v<T>)
+                return static_cast<size_t>(hash_integer(reinterpret_cast<uintptr_t>(value)));
+            else
+                return static_cast<size_t>(hash_integer(static_cast<uint64_t>(value)));
+        }
+    };
+
+    /**
+    * @brief Hashes floating point values by their bits, treating 0.0 and -0.0 as equal.
+    */
+    template<typename T>
+        requires(std::is_floating_point_v<T> && sizeof(T) <= sizeof(uint64_t))
+    struct FastHash<T> {
+        size_t operator()(T value) const {
+            if (value == T(0))
+                value = T(0);
+            uint64_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(T));
+            return static_cast<size_t>(hash_integer(bits));
+        }
+    };
+
+    /**
+    * @brief Hashes the characters of a string with hash_bytes().
+    *
+    * Transparent: std::string, std::string_view and string literals hash equally.
+    */
+    template<>
+    struct FastHash<std::string_view> {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view value) const {
+            return static_cast<size_t>(hash_bytes(value.data(), value.size()));
+        }
+    };
+
+    template<>
+    struct FastHash<std::string> : FastHash<std::string_view> {};
+
+}// namespace userDefineDataStructure
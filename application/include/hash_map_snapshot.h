@@ -0,0 +1,510 @@
+#pragma once
+
+#include "vector.h"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @file hash_map_snapshot.h
+ * @brief A versioned binary snapshot format for hash maps, read back through mmap.
+ *
+ * write_snapshot() stores the entries of any map (HashMap, FlatHashMap,
+ * std::unordered_map, ...) in a file that already contains a complete hash
+ * index. MappedHashMap maps such a file read-only and answers lookups directly
+ * from the mapped pages, so opening a snapshot costs one mmap call and lookups
+ * only fault in the pages they touch; nothing is rehashed or copied.
+ *
+ * Supported key and value types are trivially copyable types, stored as their
+ * raw bytes, and std::string, stored as an (offset, length) reference into a
+ * string heap at the end of the file. Keys stored as raw bytes must also have
+ * unique object representations (no padding, no floating point), so that equal
+ * keys always have equal bytes.
+ *
+ * File layout, every section aligned to 64 bytes:
+ * - SnapshotHeader
+ * - bucket_count + 1 uint64_t start indices into the entry array
+ * - entry_count fixed-size entries, grouped by bucket
+ * - string heap
+ *
+ * Usage example:
+ * @code
+ * userDefineDataStructure::HashMap<std::string, uint64_t> counts;
+ * counts.insert_or_assign("apples", 3);
+ * userDefineDataStructure::write_snapshot("counts.snap", counts);
+ *
+ * userDefineDataStructure::MappedHashMap<std::string, uint64_t> mapped("counts.snap");
+ * std::cout << mapped.at("apples") << std::endl;
+ * @endcode
+ *
+ * @note The hash used inside snapshots is fixed by the format version, not by
+ *       the map's hash function, so files stay readable across builds. Files are
+ *       only portable between machines of the same byte order.
+ */
+
+namespace userDefineDataStructure {
+    constexpr uint32_t kSnapshotVersion = 1;///< Format version written into every snapshot
+
+    /**
+    * @brief The fixed-size header at offset 0 of a snapshot file.
+    */
+    struct SnapshotHeader {
+        char magic[8];          ///< "UDSHMAP" followed by a zero byte
+        uint32_t version;       ///< kSnapshotVersion at the time of writing
+        uint32_t byte_order;    ///< 0x01020304 as written by the producing machine
+        uint32_t key_kind;      ///< How keys are stored, see detail::SnapshotKind
+        uint32_t value_kind;    ///< How values are stored, see detail::SnapshotKind
+        uint64_t key_size;      ///< sizeof the stored key representation
+        uint64_t value_size;    ///< sizeof the stored value representation
+        uint64_t entry_size;    ///< Size of one entry, including padding
+        uint64_t entry_count;   ///< Number of entries
+        uint64_t bucket_count;  ///< Number of buckets, a power of two
+        uint64_t buckets_offset;///< File offset of the bucket start array
+        uint64_t entries_offset;///< File offset of the entry array
+        uint64_t heap_offset;   ///< File offset of the string heap
+        uint64_t heap_size;     ///< Size of the string heap in bytes
+    };
+
+    namespace detail {
+        constexpr char kSnapshotMagic[8] = {'U', 'D', 'S', 'H', 'M', 'A', 'P', '\0'};
+        constexpr uint32_t kSnapshotByteOrder = 0x01020304;
+        constexpr uint64_t kSnapshotAlignment = 64;
+
+        /**
+        * @brief Storage kinds recorded in the header.
+        */
+        enum SnapshotKind : uint32_t {
+            kRawBytes = 0,///< The object representation of a trivially copyable type
+            kString = 1,  ///< An offset and length into the string heap
+        };
+
+        /**
+        * @brief A string stored in the snapshot's string heap.
+        */
+        struct StringRef {
+            uint64_t offset;///< Offset from the start of the heap
+            uint64_t length;///< Length in bytes
+        };
+
+        /**
+        * @brief Describes how a C++ type is represented in a snapshot.
+        *
+        * This primary template covers trivially copyable types stored as raw bytes.
+        */
+        template<typename T>
+        struct SnapshotTraits {
+            static_assert(std::is_trivially_copyable_v<T>,
+                          "snapshot keys and values must be trivially copyable or std::string");
+            using stored_type = T;      ///< Representation inside an entry
+            using view_type = const T &;///< Type handed out by lookups
+            static constexpr SnapshotKind kind = kRawBytes;
+
+            static stored_type store(const T &value, std::string &) { return value; }
+            static view_type view(const stored_type &stored, const char *, uint64_t) { return stored; }
+            static const void *bytes(const T &value) { return &value; }
+            static size_t length(const T &) { return sizeof(T); }
+        };
+
+        /**
+        * @brief std::string is stored in the string heap and read back as a string_view.
+        */
+        template<>
+        struct SnapshotTraits<std::string> {
+            using stored_type = StringRef;
+            using view_type = std::string_view;
+            static constexpr SnapshotKind kind = kString;
+
+            static stored_type store(const std::string &value, std::string &heap) {
+                StringRef ref{heap.size(), value.size()};
+                heap.append(value);
+                return ref;
+            }
+
+            static view_type view(const stored_type &stored, const char *heap, uint64_t heap_size) {
+                if (stored.offset > heap_size || stored.length > heap_size - stored.offset)
+                    throw std::runtime_error("MappedHashMap: corrupt string reference");
+                return std::string_view(heap + stored.offset, stored.length);
+            }
+
+            static const void *bytes(std::string_view value) { return value.data(); }
+            static size_t length(std::string_view value) { return value.size(); }
+        };
+
+        /**
+        * @brief One fixed-size record of the entry array.
+        */
+        template<typename Key, typename Value>
+        struct SnapshotEntry {
+            typename SnapshotTraits<Key>::stored_type key;
+            typename SnapshotTraits<Value>::stored_type value;
+        };
+
+        /**
+        * @brief The hash function of snapshot format version 1.
+        *
+        * Must never change for a given kSnapshotVersion: readers locate entries
+        * with the hash the writer used.
+        */
+        inline uint64_t snapshot_hash(const void *data, size_t length) {
+            auto fmix = [](uint64_t x) {
+                x ^= x >> 33;
+                x *= 0xFF51AFD7ED558CCDull;
+                x ^= x >> 33;
+                x *= 0xC4CEB9FE1A85EC53ull;
+                x ^= x >> 33;
+                return x;
+            };
+            const auto *bytes = static_cast<const unsigned char *>(data);
+            uint64_t h = 0x9E3779B97F4A7C15ull ^ length;
+            for (; length >= 8; bytes += 8, length -= 8) {
+                uint64_t word;
+                std::memcpy(&word, bytes, 8);
+                h = std::rotl(h ^ fmix(word), 27) * 0x9E3779B97F4A7C15ull;
+            }
+            uint64_t tail = 0;
+            std::memcpy(&tail, bytes, length);
+            return fmix(h ^ fmix(tail));
+        }
+
+        /**
+        * @brief Rounds an offset up to the section alignment.
+        */
+        constexpr uint64_t snapshot_align(uint64_t offset) {
+            return (offset + kSnapshotAlignment - 1) & ~(kSnapshotAlignment - 1);
+        }
+
+        /**
+        * @brief Flushes a file or directory to disk with fsync().
+        * @throw std::runtime_error if it cannot be opened or synced.
+        */
+        inline void snapshot_sync(const std::filesystem::path &path, int flags) {
+            int fd = ::open(path.c_str(), flags);
+            if (fd < 0)
+                throw std::runtime_error("write_snapshot: cannot open " + path.string() + " to sync it");
+            bool synced = ::fsync(fd) == 0;
+            ::close(fd);
+            if (!synced)
+                throw std::runtime_error("write_snapshot: cannot sync " + path.string());
+        }
+    }// namespace detail
+
+    /**
+    * @brief Writes the entries of a map to a snapshot file.
+    *
+    * The file is written to a temporary name next to path, flushed to disk,
+    * and renamed into place; the directory is flushed after the rename. Readers
+    * therefore never observe a partial snapshot, and after a crash path holds
+    * either the previous snapshot or the complete new one. On failure the
+    * temporary file is removed and path is left untouched.
+    *
+    * @tparam Map Any iterable of pairs with a size() member, such as HashMap.
+    * @param path Destination file.
+    * @param map The entries to store; keys must be unique.
+    * @throw std::runtime_error if the file cannot be written.
+    *
+    * Time Complexity: O(n + s), where s is the total size of the strings.
+    */
+    template<typename Map>
+    void write_snapshot(const std::filesystem::path &path, Map &&map) {
+        using Pair = std::remove_cvref_t<decltype(*std::begin(map))>;
+        using Key = std::remove_cvref_t<typename Pair::first_type>;
+        using Value = std::remove_cvref_t<typename Pair::second_type>;
+        using KeyTraits = detail::SnapshotTraits<Key>;
+        using ValueTraits = detail::SnapshotTraits<Value>;
+        using Entry = detail::SnapshotEntry<Key, Value>;
+        static_assert(KeyTraits::kind == detail::kString || std::has_unique_object_representations_v<Key>,
+                      "raw snapshot keys must not contain padding or floating point members");
+        static_assert(alignof(Entry) <= detail::kSnapshotAlignment);
+
+        const uint64_t count = map.size();
+        const uint64_t bucket_count = std::bit_ceil(count ? count : 1);
+
+        // Group the entries by bucket with a counting sort.
+        vector<uint64_t> starts(bucket_count + 1);
+        vector<uint64_t> buckets_of(count);
+        vector<const Pair *> items(count);
+        uint64_t n = 0;
+        for (const auto &pair: map) {
+            if (n == count)
+                throw std::runtime_error("write_snapshot: map changed size while being written");
+            uint64_t bucket = detail::snapshot_hash(KeyTraits::bytes(pair.first), KeyTraits::length(pair.first)) & (bucket_count - 1);
+            buckets_of[n] = bucket;
+            items[n++] = &pair;
+            ++starts[bucket + 1];
+        }
+        for (uint64_t b = 0; b < bucket_count; ++b)
+            starts[b + 1] += starts[b];
+
+        std::string heap;
+        vector<Entry> entries(count);
+        vector<uint64_t> fill(starts);
+        for (uint64_t i = 0; i < count; ++i) {
+            Entry &entry = entries[fill[buckets_of[i]]++];
+            std::memset(static_cast<void *>(&entry), 0, sizeof(Entry));
+            entry.key = KeyTraits::store(items[i]->first, heap);
+            entry.value = ValueTraits::store(items[i]->second, heap);
+        }
+
+        SnapshotHeader header{};
+        std::memcpy(header.magic, detail::kSnapshotMagic, sizeof(header.magic));
+        header.version = kSnapshotVersion;
+        header.byte_order = detail::kSnapshotByteOrder;
+        header.key_kind = KeyTraits::kind;
+        header.value_kind = ValueTraits::kind;
+        header.key_size = sizeof(typename KeyTraits::stored_type);
+        header.value_size = sizeof(typename ValueTraits::stored_type);
+        header.entry_size = sizeof(Entry);
+        header.entry_count = count;
+        header.bucket_count = bucket_count;
+        header.buckets_offset = detail::snapshot_align(sizeof(SnapshotHeader));
+        header.entries_offset = detail::snapshot_align(header.buckets_offset + (bucket_count + 1) * sizeof(uint64_t));
+        header.heap_offset = detail::snapshot_align(header.entries_offset + count * sizeof(Entry));
+        header.heap_size = heap.size();
+
+        std::filesystem::path temp = path;
+        temp += ".tmp";
+        try {
+            std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+            if (!out)
+                throw std::runtime_error("write_snapshot: cannot open " + temp.string());
+            auto write_at = [&](uint64_t offset, const void *data, uint64_t size) {
+                static const char zeros[detail::kSnapshotAlignment] = {};
+                out.write(zeros, static_cast<std::streamsize>(offset - static_cast<uint64_t>(out.tellp())));
+                out.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+            };
+            write_at(0, &header, sizeof(header));
+            write_at(header.buckets_offset, starts.data(), (bucket_count + 1) * sizeof(uint64_t));
+            write_at(header.entries_offset, entries.data(), count * sizeof(Entry));
+            write_at(header.heap_offset, heap.data(), heap.size());
+            out.close();
+            if (!out)
+                throw std::runtime_error("write_snapshot: failed writing " + temp.string());
+            detail::snapshot_sync(temp, O_WRONLY);
+            std::filesystem::rename(temp, path);
+        } catch (...) {
+            std::error_code ignored;
+            std::filesystem::remove(temp, ignored);
+            throw;
+        }
+        std::filesystem::path directory = path.parent_path();
+        detail::snapshot_sync(directory.empty() ? "." : directory, O_RDONLY | O_DIRECTORY);
+    }
+
+    /**
+    * @class MappedHashMap
+    * @brief A read-only hash map served directly from a memory-mapped snapshot file.
+    *
+    * Opening validates the header and maps the file; lookups hash the key with
+    * the snapshot hash and scan one bucket of the mapped entry array. Raw values
+    * are returned as references into the mapping and strings as string_views,
+    * both valid for the lifetime of the MappedHashMap.
+    *
+    * @tparam Key Key type the snapshot was written with.
+    * @tparam Value Value type the snapshot was written with.
+    */
+    template<typename Key, typename Value>
+    class MappedHashMap {
+    private:
+        using KeyTraits = detail::SnapshotTraits<Key>;
+        using ValueTraits = detail::SnapshotTraits<Value>;
+        using Entry = detail::SnapshotEntry<Key, Value>;
+
+    public:
+        using key_view = typename KeyTraits::view_type;    ///< Type of lookup keys
+        using value_view = typename ValueTraits::view_type;///< Type of returned values
+
+    private:
+        void *mapping = nullptr;          ///< Start of the mapped file
+        size_t mapping_size = 0;          ///< Length of the mapping
+        const SnapshotHeader *header = nullptr;
+        const uint64_t *starts = nullptr; ///< Bucket start indices
+        const Entry *entries = nullptr;   ///< Entry array
+        const char *heap = nullptr;       ///< String heap
+
+        /**
+        * @brief Checks the header against the file size and the expected types.
+        *
+        * @throw std::runtime_error describing the first mismatch.
+        */
+        void validate() const {
+            auto fail = [](const char *what) { throw std::runtime_error(std::string("MappedHashMap: ") + what); };
+            if (mapping_size < sizeof(SnapshotHeader))
+                fail("file too small for a snapshot header");
+            if (std::memcmp(header->magic, detail::kSnapshotMagic, sizeof(header->magic)) != 0)
+                fail("not a snapshot file");
+            if (header->version != kSnapshotVersion)
+                fail("unsupported snapshot version");
+            if (header->byte_order != detail::kSnapshotByteOrder)
+                fail("snapshot written with a different byte order");
+            if (header->key_kind != KeyTraits::kind || header->value_kind != ValueTraits::kind ||
+                header->key_size != sizeof(typename KeyTraits::stored_type) ||
+                header->value_size != sizeof(typename ValueTraits::stored_type) || header->entry_size != sizeof(Entry))
+                fail("snapshot key or value type does not match");
+            if (!std::has_single_bit(header->bucket_count))
+                fail("corrupt bucket count");
+
+            auto fits = [&](uint64_t offset, uint64_t count, uint64_t size) {
+                return offset % detail::kSnapshotAlignment == 0 && offset <= mapping_size &&
+                       count <= (mapping_size - offset) / size;
+            };
+            if (!fits(header->buckets_offset, header->bucket_count + 1, sizeof(uint64_t)) ||
+                !fits(header->entries_offset, header->entry_count, sizeof(Entry)) ||
+                !fits(header->heap_offset, header->heap_size, 1))
+                fail("file truncated or sections out of range");
+        }
+
+        /**
+        * @brief Finds the entry of a key.
+        *
+        * @return const Entry* The entry, or nullptr if the key is not present.
+        */
+        const Entry *find_entry(key_view key) const {
+            uint64_t bucket = detail::snapshot_hash(KeyTraits::bytes(key), KeyTraits::length(key)) & (header->bucket_count - 1);
+            uint64_t first = starts[bucket];
+            uint64_t last = std::min(starts[bucket + 1], header->entry_count);
+            for (uint64_t i = first; i < last; ++i) {
+                const Entry &entry = entries[i];
+                if constexpr (KeyTraits::kind == detail::kString) {
+                    if (KeyTraits::view(entry.key, heap, header->heap_size) == key)
+                        return &entry;
+                } else {
+                    if (std::memcmp(&entry.key, &key, sizeof(Key)) == 0)
+                        return &entry;
+                }
+            }
+            return nullptr;
+        }
+
+        void release() {
+            if (mapping)
+                ::munmap(mapping, mapping_size);
+            mapping = nullptr;
+        }
+
+    public:
+        /**
+        * @brief Maps a snapshot file read-only.
+        *
+        * @param path The snapshot written by write_snapshot() with the same key and value types.
+        * @throw std::runtime_error if the file cannot be mapped or is not a matching snapshot.
+        *
+        * Time Complexity: O(1); pages are loaded on first access.
+        */
+        explicit MappedHashMap(const std::filesystem::path &path) {
+            int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0)
+                throw std::runtime_error("MappedHashMap: cannot open " + path.string());
+            struct stat info {};
+            if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+                ::close(fd);
+                throw std::runtime_error("MappedHashMap: cannot map empty file " + path.string());
+            }
+            mapping_size = static_cast<size_t>(info.st_size);
+            mapping = ::mmap(nullptr, mapping_size, PROT_READ, MAP_SHARED, fd, 0);
+            ::close(fd);
+            if (mapping == MAP_FAILED) {
+                mapping = nullptr;
+                throw std::runtime_error("MappedHashMap: mmap failed for " + path.string());
+            }
+
+            const char *base = static_cast<const char *>(mapping);
+            header = reinterpret_cast<const SnapshotHeader *>(base);
+            try {
+                validate();
+            } catch (...) {
+                release();
+                throw;
+            }
+            starts = reinterpret_cast<const uint64_t *>(base + header->buckets_offset);
+            entries = reinterpret_cast<const Entry *>(base + header->entries_offset);
+            heap = base + header->heap_offset;
+        }
+
+        MappedHashMap(const MappedHashMap &) = delete;
+        MappedHashMap &operator=(const MappedHashMap &) = delete;
+
+        MappedHashMap(MappedHashMap &&other) noexcept
+            : mapping(std::exchange(other.mapping, nullptr)), mapping_size(other.mapping_size),
+              header(std::exchange(other.header, nullptr)), starts(other.starts), entries(other.entries), heap(other.heap) {}
+
+        MappedHashMap &operator=(MappedHashMap &&other) noexcept {
+            if (this != &other) {
+                release();
+                mapping = std::exchange(other.mapping, nullptr);
+                mapping_size = other.mapping_size;
+                header = std::exchange(other.header, nullptr);
+                starts = other.starts;
+                entries = other.entries;
+                heap = other.heap;
+            }
+            return *this;
+        }
+
+        ~MappedHashMap() { release(); }
+
+        /**
+        * @brief Checks if the snapshot contains a key.
+        *
+        * @param key The key to search for.
+        * @return true If the key is present.
+        *
+        * Time Complexity: O(1) on average.
+        */
+        bool contains(key_view key) const { return find_entry(key) != nullptr; }
+
+        /**
+        * @brief Accesses the value of a key.
+        *
+        * @param key The key of the element to access.
+        * @return value_view The value, pointing into the mapping.
+        * @throw std::out_of_range if the key is not found.
+        *
+        * Time Complexity: O(1) on average.
+        */
+        value_view at(key_view key) const {
+            const Entry *entry = find_entry(key);
+            if (!entry)
+                throw std::out_of_range("Key not found in MappedHashMap");
+            return ValueTraits::view(entry->value, heap, header->heap_size);
+        }
+
+        /**
+        * @brief Returns the number of entries.
+        */
+        size_t size() const { return header ? header->entry_count : 0; }
+
+        /**
+        * @brief Checks if the snapshot has no entries.
+        */
+        bool empty() const { return size() == 0; }
+
+        /**
+        * @brief Calls a function with every key and value, in file order.
+        *
+        * @tparam F Callable as f(key_view, value_view).
+        * @param visitor Invoked once per entry.
+        *
+        * Time Complexity: O(n)
+        */
+        template<typename F>
+        void for_each(F &&visitor) const {
+            for (uint64_t i = 0; i < header->entry_count; ++i)
+                visitor(KeyTraits::view(entries[i].key, heap, header->heap_size),
+                        ValueTraits::view(entries[i].value, heap, header->heap_size));
+        }
+    };
+
+}// namespace userDefineDataStructure
@@ -1,10 +1,25 @@
 #pragma once
 
+#include "frozen_hash_map.h"
 #include "list.h"
+#include "node_pool.h"
+#include "set.h"
 #include "vector.h"
+#include <atomic>
+#include <bit>
+#include <chrono>
 #include <cmath>
+#include <cstdint>
+#include <exception>
 #include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <span>
 #include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 
 /**
@@ -18,12 +33,23 @@
  * @tparam Key The type of keys stored in the hash map.
  * @tparam Value The type of mapped values.
  * @tparam Hash The hash function type, defaults to std::hash<Key>.
+ * @tparam Policy Compile-time options, defaults to HashMapPolicy.
  *
  * Key features:
  * - Amortized constant time complexity for insert, delete, and search operations
  * - Automatic resizing to maintain load factor
  * - Custom hash function support
  * - Iterator support for traversing all elements
+ * - Optional incremental rehashing that spreads table growth over many operations
+ * - Optional per-entry hash caching and power-of-two bucket masking (see HashMapPolicy)
+ * - Optional treeified buckets that bound lookups in overfull chains to O(log n)
+ * - Optional statistics on chain lengths, comparisons and rehashing (see HashMapStats)
+ * - freeze() into an immutable perfect-hash FrozenHashMap for read-only data
+ * - Bulk construction from a range that sizes the table once and can hash in parallel
+ * - Batched lookups that prefetch buckets to overlap cache misses
+ * - Heterogeneous lookup, e.g. by std::string_view, with a transparent hash function
+ * - parallel_for_each / parallel_reduce that split full-table scans across threads
+ * - Optional slab-pooled node storage, freed wholesale on clear() (see PoolNodeAllocator)
  *
  * Usage example:
  * @code
@@ -37,200 +63,1482 @@
  * @endcode
  *
  * @warning This class is not thread-safe. External synchronization is required
- *          for concurrent access.
+ *          for concurrent access; ConcurrentHashMap (concurrent_hash_map.h) provides
+ *          a sharded, thread-safe map built on HashMap.
  */
 
 namespace userDefineDataStructure {
-    template<typename Key, typename Value, typename Hash = std::hash<Key>>
+    /**
+    * @brief Bucket sizing that maps a hash to a bucket with a modulo.
+    *
+    * Accepts any bucket count and uses the hash as is, so every bit of the hash
+    * contributes to the bucket choice. Costs an integer division per lookup.
+    */
+    struct ModuloBucketPolicy {
+        /**
+        * @brief Returns the bucket count to use for a requested count.
+        */
+        static size_t bucket_count(size_t requested) { return requested ? requested : 1; }
+
+        /**
+        * @brief Maps a hash to a bucket index.
+        */
+        static size_t index(size_t hash, size_t count) { return hash % count; }
+    };
+
+    /**
+    * @brief Bucket sizing that keeps a power-of-two table and masks the hash.
+    *
+    * A mask alone only looks at the low bits of the hash, which for the identity
+    * std::hash of integers would send strided keys to the same few buckets. The
+    * hash is therefore first multiplied by 2^64 / phi (Fibonacci hashing) and
+    * rotated so the product's high bits, which depend on every input bit, are
+    * the ones that end up under the mask.
+    */
+    struct PowerOfTwoBucketPolicy {
+        /**
+        * @brief Returns the smallest power of two not below the requested count.
+        */
+        static size_t bucket_count(size_t requested) { return std::bit_ceil(requested ? requested : 1); }
+
+        /**
+        * @brief Maps a hash to a bucket index; count must be a power of two.
+        */
+        static size_t index(size_t hash, size_t count) {
+            uint64_t h = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+            return static_cast<size_t>(std::rotl(h, std::countr_zero(count))) & (count - 1);
+        }
+    };
+
+    /**
+    * @brief Default compile-time options for HashMap.
+    *
+    * Derive from this struct and shadow the members to change a HashMap's behavior:
+    * @code
+    * struct CachedHashPolicy : userDefineDataStructure::HashMapPolicy {
+    *     static constexpr bool cache_hash_code = true;
+    * };
+    * userDefineDataStructure::HashMap<std::string, int, std::hash<std::string>, CachedHashPolicy> map;
+    * @endcode
+    */
+    struct HashMapPolicy {
+        /**
+        * @brief Store each entry's full hash next to it.
+        *
+        * Rehashing then never calls the hash function, and chain walks skip
+        * entries whose hash differs before comparing keys. Worth it for keys that
+        * are expensive to hash or compare, such as strings; costs one size_t per entry.
+        */
+        static constexpr bool cache_hash_code = false;
+
+        /**
+        * @brief How the bucket count is chosen and how a hash selects a bucket.
+        *
+        * ModuloBucketPolicy or PowerOfTwoBucketPolicy.
+        */
+        using bucket_policy = ModuloBucketPolicy;
+
+        /**
+        * @brief Chain length above which a bucket is indexed by a red-black tree, 0 to never do so.
+        *
+        * Protects against bad hash functions and adversarial keys: lookups in a
+        * treeified bucket take O(log n) comparisons instead of O(n). The tree is
+        * dropped again once the chain shrinks to half the threshold.
+        */
+        static constexpr size_t treeify_threshold = 0;
+
+        /**
+        * @brief Strict weak ordering on keys used by treeified buckets.
+        *
+        * Must agree with key equality: two keys are equal exactly when neither
+        * orders before the other.
+        */
+        using key_compare = std::less<>;
+
+        /**
+        * @brief Equality predicate on keys.
+        *
+        * When both this and the hash function define is_transparent, lookups
+        * (at, contains, find, erase) accept any type the two can handle, for
+        * example std::string_view or const char * for a map keyed by std::string,
+        * without constructing a temporary Key. FastHash<std::string> (hash.h) is
+        * such a transparent hash function; key_compare must then accept the type too.
+        */
+        using key_equal = std::equal_to<>;
+
+        /**
+        * @brief Record lookup, rehash and allocation counters, readable through HashMap::stats().
+        *
+        * Counters are relaxed atomics so that concurrent readers, such as those
+        * of a ConcurrentHashMap shard, may update them. When false the counters
+        * occupy no storage and every update compiles away.
+        */
+        static constexpr bool collect_stats = false;
+
+        /**
+        * @brief How the list nodes holding the entries are allocated.
+        *
+        * HeapNodeAllocator allocates each node separately. PoolNodeAllocator
+        * (node_pool.h) carves nodes out of 64 KiB slabs owned by the map: no
+        * per-node malloc header, O(1) reuse of erased nodes, and all node memory
+        * returned at once by clear() and destruction. Costs one pointer per bucket.
+        */
+        using node_allocator = HeapNodeAllocator;
+    };
+
+    /**
+    * @brief A snapshot of a HashMap's statistics.
+    *
+    * Returned by HashMap::stats() when the map's policy enables collect_stats.
+    * Counts cover the map's lifetime, or the time since reset_stats(); a copied
+    * map starts with fresh counters.
+    */
+    struct HashMapStats {
+        size_t lookups = 0;                     ///< Bucket searches, one per find, insert and erase
+        size_t comparisons = 0;                 ///< Key comparisons made by those searches
+        size_t max_comparisons = 0;             ///< Most key comparisons made by a single search
+        size_t rehashes = 0;                    ///< Times the table was resized
+        std::chrono::nanoseconds rehash_time{0};///< Time spent moving entries between tables
+        size_t allocations = 0;                 ///< Entry nodes and bucket arrays allocated
+        vector<size_t> chain_length_histogram;  ///< Element n is the number of buckets holding n entries
+
+        /**
+        * @brief Returns the mean number of key comparisons per search.
+        */
+        double average_comparisons() const {
+            return lookups ? static_cast<double>(comparisons) / static_cast<double>(lookups) : 0.0;
+        }
+    };
+
+    namespace detail {
+        /**
+        * @brief A key-value pair as stored in a HashMap bucket.
+        *
+        * This primary template stores only the pair and recomputes the hash on demand.
+        *
+        * @tparam Pair The key-value pair type.
+        * @tparam CacheHash Whether the entry keeps its hash code.
+        */
+        template<typename Pair, bool CacheHash>
+        struct HashEntry {
+            Pair kv;///< The stored key-value pair
+
+            template<typename... Args>
+            explicit HashEntry(size_t, Args &&...args) : kv(std::forward<Args>(args)...) {}
+
+            /**
+            * @brief Returns the entry's hash code.
+            */
+            template<typename H>
+            size_t hash(const H &hasher) const { return hasher(kv.first); }
+
+            /**
+            * @brief Records the hash of an entry built before its key was hashed; nothing to record here.
+            */
+            void set_hash(size_t) {}
+
+            /**
+            * @brief Cheap pre-check before a key comparison; always passes without a cached hash.
+            */
+            bool hash_matches(size_t) const { return true; }
+
+            bool operator==(const HashEntry &other) const { return kv == other.kv; }
+        };
+
+        /**
+        * @brief A key-value pair that also stores its hash code.
+        *
+        * @tparam Pair The key-value pair type.
+        */
+        template<typename Pair>
+        struct HashEntry<Pair, true> {
+            Pair kv;         ///< The stored key-value pair
+            size_t hash_code;///< Full hash of kv.first
+
+            template<typename... Args>
+            explicit HashEntry(size_t hash, Args &&...args) : kv(std::forward<Args>(args)...), hash_code(hash) {}
+
+            template<typename H>
+            size_t hash(const H &) const { return hash_code; }
+
+            void set_hash(size_t hash) { hash_code = hash; }
+
+            bool hash_matches(size_t hash) const { return hash_code == hash; }
+
+            bool operator==(const HashEntry &other) const { return kv == other.kv; }
+        };
+
+        /**
+        * @brief A bucket chain that can carry a red-black tree index over its nodes.
+        *
+        * The entries always stay in the list, so iteration, splicing and node
+        * addresses are unaffected; the index only holds list iterators ordered
+        * by key and is rebuilt rather than copied when the bucket is copied.
+        *
+        * @tparam Entry The stored entry type.
+        * @tparam Key The key type.
+        * @tparam Compare Strict weak ordering on keys.
+        * @tparam NodeAllocator Allocator of the list nodes.
+        */
+        template<typename Entry, typename Key, typename Compare, typename NodeAllocator>
+        struct TreeBucket : List<Entry, NodeAllocator> {
+            using Chain = List<Entry, NodeAllocator>;
+            using iterator = typename Chain::iterator;
+
+            /**
+            * @brief Orders list iterators by the keys they point to; also compares against bare keys.
+            */
+            struct IteratorLess {
+                using is_transparent = void;
+                Compare comp;
+
+                bool operator()(const iterator &a, const iterator &b) const { return comp(a->kv.first, b->kv.first); }
+                template<typename K>
+                bool operator()(const iterator &a, const K &b) const { return comp(a->kv.first, b); }
+                template<typename K>
+                bool operator()(const K &a, const iterator &b) const { return comp(a, b->kv.first); }
+            };
+
+            std::unique_ptr<set<iterator, IteratorLess>> index;///< Present only while the bucket is treeified
+
+            TreeBucket()
+                requires std::default_initializable<NodeAllocator>
+            = default;
+            explicit TreeBucket(const NodeAllocator &alloc) : Chain(alloc) {}
+            TreeBucket(TreeBucket &&) noexcept = default;
+            TreeBucket &operator=(TreeBucket &&) noexcept = default;
+
+            TreeBucket(const TreeBucket &other) : TreeBucket(other, other.get_allocator()) {}
+
+            TreeBucket(const TreeBucket &other, const NodeAllocator &alloc) : Chain(other, alloc) {
+                if (other.index)
+                    treeify();
+            }
+
+            TreeBucket &operator=(const TreeBucket &other) {
+                if (this != &other) {
+                    Chain::operator=(other);// copies into this bucket's own allocator
+                    index.reset();
+                    if (other.index)
+                        treeify();
+                }
+                return *this;
+            }
+
+            /**
+            * @brief Builds the index over every entry of the chain.
+            */
+            void treeify() {
+                index = std::make_unique<set<iterator, IteratorLess>>();
+                for (auto it = this->begin(); it != this->end(); ++it)
+                    index->insert(it);
+            }
+
+            /**
+            * @brief Removes all entries and the index.
+            */
+            void clear() {
+                index.reset();
+                Chain::clear();
+            }
+        };
+
+        /**
+        * @brief Statistics counters of a HashMap; this disabled version is empty and does nothing.
+        */
+        template<bool Enabled>
+        struct HashMapCounters {
+            struct RehashTimer {};
+
+            void record_lookup(size_t) const {}
+            void record_allocation() {}
+            RehashTimer time_rehash() { return {}; }
+            void record_rehash() {}
+        };
+
+        /**
+        * @brief Statistics counters of a HashMap.
+        */
+        template<>
+        struct HashMapCounters<true> {
+            mutable std::atomic<size_t> lookups{0};        ///< Bucket searches
+            mutable std::atomic<size_t> comparisons{0};    ///< Key comparisons during searches
+            mutable std::atomic<size_t> max_comparisons{0};///< Longest single search
+            std::atomic<size_t> rehashes{0};               ///< Table resizes
+            std::atomic<int64_t> rehash_nanos{0};          ///< Time spent moving entries
+            std::atomic<size_t> allocations{0};            ///< Nodes and bucket arrays allocated
+
+            /**
+            * @brief Adds the time until its destruction to rehash_nanos.
+            */
+            struct RehashTimer {
+                HashMapCounters *counters;
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+                ~RehashTimer() {
+                    auto elapsed = std::chrono::steady_clock::now() - start;
+                    counters->rehash_nanos.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+                                                     std::memory_order_relaxed);
+                }
+            };
+
+            HashMapCounters() = default;
+            HashMapCounters(const HashMapCounters &) {}
+            HashMapCounters &operator=(const HashMapCounters &) { return *this; }
+
+            void record_lookup(size_t compared) const {
+                lookups.fetch_add(1, std::memory_order_relaxed);
+                comparisons.fetch_add(compared, std::memory_order_relaxed);
+                size_t longest = max_comparisons.load(std::memory_order_relaxed);
+                while (compared > longest && !max_comparisons.compare_exchange_weak(longest, compared, std::memory_order_relaxed)) {
+                }
+            }
+
+            void record_allocation() { allocations.fetch_add(1, std::memory_order_relaxed); }
+
+            RehashTimer time_rehash() { return RehashTimer{this}; }
+
+            void record_rehash() { rehashes.fetch_add(1, std::memory_order_relaxed); }
+
+            void reset() {
+                lookups = 0;
+                comparisons = 0;
+                max_comparisons = 0;
+                rehashes = 0;
+                rehash_nanos = 0;
+                allocations = 0;
+            }
+        };
+
+        /**
+        * @brief Owns the resource a HashMap's node allocator draws from; empty for stateless allocators.
+        */
+        template<typename NodeAllocator>
+        struct NodeStorage {
+            NodeAllocator allocator() const { return NodeAllocator(); }
+            void release() {}
+        };
+
+        /**
+        * @brief NodeStorage for allocators that draw from a pool; the map owns the pool.
+        *
+        * A copy gets a fresh pool, and the pool keeps its address when moved
+        * because the buckets' allocators point to it.
+        */
+        template<typename NodeAllocator>
+            requires requires { typename NodeAllocator::pool_type; }
+        struct NodeStorage<NodeAllocator> {
+            std::unique_ptr<typename NodeAllocator::pool_type> pool =
+                    std::make_unique<typename NodeAllocator::pool_type>();
+
+            NodeStorage() = default;
+            NodeStorage(const NodeStorage &) : NodeStorage() {}
+            NodeStorage(NodeStorage &&) noexcept = default;
+            NodeStorage &operator=(NodeStorage &&) noexcept = default;
+
+            NodeAllocator allocator() const { return NodeAllocator(pool.get()); }
+            void release() {
+                if (pool)
+                    pool->release();
+            }
+        };
+
+        /**
+        * @brief Satisfied when a hash function and equality predicate both accept keys of other types.
+        */
+        template<typename Hash, typename KeyEqual>
+        concept transparent_lookup = requires {
+            typename Hash::is_transparent;
+            typename KeyEqual::is_transparent;
+        };
+    }// namespace detail
+
+    template<typename Key, typename Value, typename Hash = std::hash<Key>, typename Policy = HashMapPolicy>
     class HashMap {
+    public:
+        class iterator;
+        class const_iterator;
+
     private:
-        using Bucket = List<std::pair<const Key, Value>>;///< Type alias for a bucket (linked list of key-value pairs)
-        using BucketVector = vector<Bucket>;             ///< Type alias for the vector of buckets
+        using Entry = detail::HashEntry<std::pair<const Key, Value>, Policy::cache_hash_code>;///< Stored element type
+        static constexpr bool treeify = Policy::treeify_threshold > 0;///< Whether buckets may be treeified
+        using NodeAllocator = typename Policy::node_allocator;///< Allocator of the entry nodes
+        using Bucket = std::conditional_t<treeify,
+                                          detail::TreeBucket<Entry, Key, typename Policy::key_compare, NodeAllocator>,
+                                          List<Entry, NodeAllocator>>;///< Type alias for a bucket (linked list of entries)
+        using BucketVector = vector<Bucket>;///< Type alias for the vector of buckets
+        using BucketPolicy = typename Policy::bucket_policy;///< Bucket sizing and indexing
 
-        BucketVector buckets;  ///< Vector of buckets for separate chaining
-        size_t size_;          ///< Current number of elements in the hash map
-        float max_load_factor_;///< Maximum load factor before rehashing
-        Hash hasher;           ///< Hash function object
+        detail::NodeStorage<NodeAllocator> storage;///< Node pool, if any; declared first so it outlives the buckets
+        BucketVector buckets;    ///< Vector of buckets for separate chaining
+        BucketVector old_buckets;///< Buckets still being drained by an incremental rehash
+        size_t migrate_index;    ///< Next bucket of old_buckets to migrate
+        size_t rehash_step_;     ///< Buckets migrated per operation, 0 for a blocking rehash
+        size_t size_;            ///< Current number of elements in the hash map
+        float max_load_factor_;  ///< Maximum load factor before rehashing
+        Hash hasher;             ///< Hash function object
+        [[no_unique_address]] typename Policy::key_equal key_eq;///< Key equality predicate
+        [[no_unique_address]] detail::HashMapCounters<Policy::collect_stats> counters;///< Statistics, empty unless enabled
 
         /**
         * @brief Finds an element with the specified key in a bucket.
         *
-        * @param bucket The bucket to search in.
+        * @tparam K Key, or another type accepted by a transparent hash function and key_equal.
+        * @param bucket The bucket to search in.
+        * @param key The key to search for.
+        * @param hash The hash of key.
+        * @return typename Bucket::iterator Iterator to the found element, or end iterator if not found.
+        */
+        template<typename K>
+        typename Bucket::iterator find_in_bucket(Bucket &bucket, const K &key, size_t hash) {
+            if constexpr (treeify) {
+                if (bucket.index) {
+                    counters.record_lookup(std::bit_width(bucket.index->size()));
+                    auto found = bucket.index->find(key);
+                    return found == bucket.index->end() ? bucket.end() : *found;
+                }
+            }
+            size_t compared = 0;
+            auto it = std::find_if(bucket.begin(), bucket.end(), [&](const Entry &entry) {
+                if (!entry.hash_matches(hash))
+                    return false;
+                ++compared;
+                return key_eq(entry.kv.first, key);
+            });
+            counters.record_lookup(compared);
+            return it;
+        }
+
+        /**
+        * @brief Finds an element with the specified key in a bucket (const version).
+        *
+        * @tparam K Key, or another type accepted by a transparent hash function and key_equal.
+        * @param bucket The bucket to search in.
+        * @param key The key to search for.
+        * @param hash The hash of key.
+        * @return typename Bucket::const_iterator Const iterator to the found element, or end iterator if not found.
+        */
+        template<typename K>
+        typename Bucket::const_iterator find_in_bucket(const Bucket &bucket, const K &key, size_t hash) const {
+            if constexpr (treeify) {
+                if (bucket.index) {
+                    counters.record_lookup(std::bit_width(bucket.index->size()));
+                    auto found = bucket.index->find(key);
+                    return found == bucket.index->end() ? bucket.end() : typename Bucket::const_iterator(*found);
+                }
+            }
+            size_t compared = 0;
+            auto it = std::find_if(bucket.begin(), bucket.end(), [&](const Entry &entry) {
+                if (!entry.hash_matches(hash))
+                    return false;
+                ++compared;
+                return key_eq(entry.kv.first, key);
+            });
+            counters.record_lookup(compared);
+            return it;
+        }
+
+        /**
+        * @brief Registers an entry just linked into a bucket, treeifying the bucket if it grew too long.
+        *
+        * @param bucket The bucket the entry was linked into.
+        * @param it The new entry.
+        */
+        void on_linked(Bucket &bucket, typename Bucket::iterator it) {
+            if constexpr (treeify) {
+                if (bucket.index)
+                    bucket.index->insert(it);
+                else if (bucket.size() > Policy::treeify_threshold)
+                    bucket.treeify();
+            } else {
+                (void) bucket;
+                (void) it;
+            }
+        }
+
+        /**
+        * @brief Unregisters an entry about to be unlinked from a bucket, dropping the tree once the chain is short.
+        *
+        * @param bucket The bucket holding the entry.
+        * @param it The entry being removed.
+        */
+        void on_unlinking(Bucket &bucket, typename Bucket::iterator it) {
+            if constexpr (treeify) {
+                if (!bucket.index)
+                    return;
+                if (bucket.size() - 1 <= Policy::treeify_threshold / 2)
+                    bucket.index.reset();
+                else
+                    bucket.index->erase(it);
+            } else {
+                (void) bucket;
+                (void) it;
+            }
+        }
+
+        /**
+        * @brief Hints the CPU to start loading a cache line.
+        *
+        * @param address Any address within the line; may be null.
+        */
+        static void prefetch(const void *address) {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(address);
+#else
+            (void) address;
+#endif
+        }
+
+        /**
+        * @brief Resolves a batch of keys with their memory accesses interleaved.
+        *
+        * The keys flow through a three-stage software pipeline: key i is hashed
+        * and its bucket header prefetched, the first node of key i - 8's chain is
+        * prefetched (its header has arrived by then), and key i - 16's chain is
+        * walked (its node has arrived by then). The cache misses of up to 16 keys
+        * are thereby in flight at once instead of one after another.
+        *
+        * @tparam F Callable as f(size_t position, const Entry *entry), entry null if missing.
+        * @param keys The keys to look up.
+        * @param visit Receives each result in key order.
+        */
+        template<typename F>
+        void resolve_batch(std::span<const Key> keys, F &&visit) const {
+            constexpr size_t distance = 8;
+            constexpr size_t window = 2 * distance;
+            size_t hashes[window];
+            const Bucket *targets[window];
+            const size_t n = keys.size();
+            for (size_t i = 0; i < n + window; ++i) {
+                if (i >= window) {
+                    size_t j = i - window;
+                    const Bucket *bucket = targets[j % window];
+                    auto it = find_in_bucket(*bucket, keys[j], hashes[j % window]);
+                    visit(j, it == bucket->end() ? nullptr : &*it);
+                }
+                if (i >= distance && i - distance < n) {
+                    const Bucket *bucket = targets[(i - distance) % window];
+                    if (!bucket->empty())
+                        prefetch(&*bucket->begin());
+                }
+                if (i < n) {
+                    hashes[i % window] = hasher(keys[i]);
+                    targets[i % window] = &locate(hashes[i % window]);
+                    prefetch(targets[i % window]);
+                }
+            }
+        }
+
+        /**
+        * @brief Implements at() for Key and transparent key types.
+        */
+        template<typename K>
+        const Value &at_key(const K &key) const {
+            size_t hash = hasher(key);
+            const auto &bucket = locate(hash);
+            auto it = find_in_bucket(bucket, key, hash);
+            if (it == bucket.end())
+                throw std::out_of_range("Key not found in HashMap");
+            return it->kv.second;
+        }
+
+        /**
+        * @brief Implements contains() for Key and transparent key types.
+        */
+        template<typename K>
+        bool contains_key(const K &key) const {
+            size_t hash = hasher(key);
+            const auto &bucket = locate(hash);
+            return find_in_bucket(bucket, key, hash) != bucket.end();
+        }
+
+        /**
+        * @brief Implements find() for Key and transparent key types.
+        */
+        template<typename K>
+        iterator find_key(const K &key) {
+            size_t hash = hasher(key);
+            auto &bucket = locate(hash);
+            auto it = find_in_bucket(bucket, key, hash);
+            if (it == bucket.end())
+                return end();
+            return iterator(this, position_of(bucket), it);
+        }
+
+        /**
+        * @brief Implements find() const for Key and transparent key types.
+        */
+        template<typename K>
+        const_iterator find_key(const K &key) const {
+            size_t hash = hasher(key);
+            const auto &bucket = locate(hash);
+            auto it = find_in_bucket(bucket, key, hash);
+            if (it == bucket.end())
+                return end();
+            return const_iterator(this, position_of(bucket), it);
+        }
+
+        /**
+        * @brief Implements erase() for Key and transparent key types.
+        */
+        template<typename K>
+        bool erase_key(const K &key) {
+            advance_rehash();
+            size_t hash = hasher(key);
+            auto &bucket = locate(hash);
+            auto it = find_in_bucket(bucket, key, hash);
+            if (it != bucket.end()) {
+                on_unlinking(bucket, it);
+                bucket.erase(it);
+                --size_;
+                return true;
+            }
+            return false;
+        }
+
+        /**
+        * @brief Calculates the bucket index for a given key.
+        *
+        * @param key The key to hash.
+        * @return size_t The calculated bucket index.
+        */
+        size_t bucket_index(const Key &key) const {
+            return BucketPolicy::index(hasher(key), buckets.size());
+        }
+
+        /**
+        * @brief Returns the bucket that holds a key, or would hold it once inserted.
+        *
+        * While an incremental rehash is in progress, keys whose old bucket has not
+        * been migrated yet stay in the old table (new insertions included), and all
+        * other keys live in the new table. Every key therefore has exactly one home
+        * and a lookup only ever searches a single chain.
+        *
+        * @param hash The hash of the key to locate.
+        * @return Bucket& The bucket responsible for the key.
+        */
+        Bucket &locate(size_t hash) {
+            return const_cast<Bucket &>(static_cast<const HashMap *>(this)->locate(hash));
+        }
+
+        /**
+        * @brief Returns the bucket that holds a key (const version).
+        *
+        * @param hash The hash of the key to locate.
+        * @return const Bucket& The bucket responsible for the key.
+        */
+        const Bucket &locate(size_t hash) const {
+            if (!old_buckets.empty()) {
+                size_t old_index = BucketPolicy::index(hash, old_buckets.size());
+                if (old_index >= migrate_index)
+                    return old_buckets[old_index];
+            }
+            return buckets[BucketPolicy::index(hash, buckets.size())];
+        }
+
+        /**
+        * @brief Moves every element of one old bucket into the new table.
+        *
+        * @param old_index Index of the bucket in old_buckets.
+        */
+        void migrate_bucket(size_t old_index) {
+            move_nodes(old_buckets[old_index], buckets);
+        }
+
+        /**
+        * @brief Relinks every node of a bucket into its bucket of another table.
+        *
+        * Nodes are spliced rather than copied, so no element is copied and no
+        * memory is allocated; references to the elements stay valid.
+        *
+        * @param from The bucket to drain.
+        * @param to The table that receives the nodes.
+        */
+        void move_nodes(Bucket &from, BucketVector &to) {
+            if constexpr (treeify)
+                from.index.reset();
+            while (!from.empty()) {
+                auto first = from.begin();
+                auto &target = to[BucketPolicy::index(first->hash(hasher), to.size())];
+                target.splice(target.end(), from, first);
+                on_linked(target, first);
+            }
+        }
+
+        /**
+        * @brief Migrates up to rehash_step_ buckets of a pending incremental rehash.
+        *
+        * Releases the old table once its last bucket has been drained.
+        */
+        void advance_rehash() {
+            if (old_buckets.empty()) return;
+            [[maybe_unused]] auto timer = counters.time_rehash();
+            for (size_t n = 0; n < rehash_step_ && migrate_index < old_buckets.size(); ++n)
+                migrate_bucket(migrate_index++);
+            if (migrate_index == old_buckets.size())
+                old_buckets = BucketVector();
+        }
+
+        /**
+        * @brief Drains a pending incremental rehash completely.
+        */
+        void finish_rehash() {
+            if (old_buckets.empty()) return;
+            [[maybe_unused]] auto timer = counters.time_rehash();
+            while (migrate_index < old_buckets.size())
+                migrate_bucket(migrate_index++);
+            old_buckets = BucketVector();
+        }
+
+        /**
+        * @brief Creates a table of empty buckets.
+        *
+        * @param count The number of buckets.
+        * @param alloc The node allocator of the buckets, from this map's storage.
+        * @return BucketVector The new table.
+        */
+        static BucketVector make_buckets(size_t count, const NodeAllocator &alloc) {
+            return BucketVector(count, Bucket(alloc));
+        }
+
+        /**
+        * @brief Copies a table of another map, giving the copied buckets another node allocator.
+        *
+        * @param from The table to copy.
+        * @param alloc The node allocator of the copies, from this map's storage.
+        * @return BucketVector The copy, with the same bucket layout.
+        */
+        static BucketVector copy_buckets(const BucketVector &from, const NodeAllocator &alloc) {
+            BucketVector result;
+            result.reserve(from.size());
+            for (const auto &bucket: from)
+                result.push_back(Bucket(bucket, alloc));
+            return result;
+        }
+
+        /**
+        * @brief Returns the number of buckets across the old and new tables.
+        */
+        size_t total_buckets() const { return old_buckets.size() + buckets.size(); }
+
+        /**
+        * @brief Returns a bucket by its position across the old and new tables.
+        *
+        * Positions below old_buckets.size() refer to the old table.
+        *
+        * @param i The combined bucket position.
+        * @return Bucket& The bucket at that position.
+        */
+        Bucket &bucket_at(size_t i) {
+            return i < old_buckets.size() ? old_buckets[i] : buckets[i - old_buckets.size()];
+        }
+
+        /**
+        * @brief Returns a bucket by its position across the old and new tables (const version).
+        */
+        const Bucket &bucket_at(size_t i) const {
+            return i < old_buckets.size() ? old_buckets[i] : buckets[i - old_buckets.size()];
+        }
+
+        /**
+        * @brief Returns the combined position of a bucket across the old and new tables.
+        *
+        * @param bucket A bucket of either table.
+        * @return size_t The position for which bucket_at() returns bucket.
+        */
+        size_t position_of(const Bucket &bucket) const {
+            if (!old_buckets.empty() && &bucket >= old_buckets.data() && &bucket < old_buckets.data() + old_buckets.size())
+                return static_cast<size_t>(&bucket - old_buckets.data());
+            return old_buckets.size() + static_cast<size_t>(&bucket - buckets.data());
+        }
+
+        /**
+        * @brief Finds a key, constructing its value in place if it is missing.
+        *
+        * The key is only moved from and the arguments only consumed when a new
+        * element is inserted.
+        *
+        * @param key The key to look up or insert.
+        * @param args Arguments forwarded to the Value constructor on insertion.
+        * @return std::pair<iterator, bool> The element and whether it was inserted.
+        */
+        template<typename K, typename... Args>
+        std::pair<iterator, bool> find_or_emplace(K &&key, Args &&...args) {
+            size_t hash = hasher(key);
+            return find_or_emplace_hashed(hash, std::forward<K>(key), std::forward<Args>(args)...);
+        }
+
+        /**
+        * @brief find_or_emplace() for a key whose hash is already known.
+        *
+        * @param hash The hash of key.
+        * @param key The key to look up or insert.
+        * @param args Arguments forwarded to the Value constructor on insertion.
+        * @return std::pair<iterator, bool> The element and whether it was inserted.
+        */
+        template<typename K, typename... Args>
+        std::pair<iterator, bool> find_or_emplace_hashed(size_t hash, K &&key, Args &&...args) {
+            check_for_rehash();
+            auto &bucket = locate(hash);
+            auto it = find_in_bucket(bucket, key, hash);
+            if (it != bucket.end())
+                return {iterator(this, position_of(bucket), it), false};
+            counters.record_allocation();
+            it = bucket.emplace(bucket.end(), hash, std::piecewise_construct,
+                                std::forward_as_tuple(std::forward<K>(key)),
+                                std::forward_as_tuple(std::forward<Args>(args)...));
+            on_linked(bucket, it);
+            ++size_;
+            return {iterator(this, position_of(bucket), it), true};
+        }
+
+        /**
+        * @brief Computes the hash of every key in a random-access range.
+        *
+        * Large ranges are split into contiguous chunks hashed by separate threads;
+        * the hash function must then be safe to call concurrently. An exception
+        * thrown by the hash function is rethrown on the calling thread.
+        *
+        * @param first Beginning of the range; hashes.size() elements are read.
+        * @param hashes Receives the hash of each element's key.
+        * @param threads Maximum number of threads, 0 for one per hardware thread.
+        */
+        template<typename RandomIt>
+        void hash_range(RandomIt first, vector<size_t> &hashes, size_t threads) const {
+            const size_t n = hashes.size();
+            run_chunks(n, chunk_count(n, threads), [&](size_t, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i)
+                    hashes[i] = hasher(first[i].first);
+            });
+        }
+
+        /**
+        * @brief Returns how many threads to split n units of work across.
+        *
+        * @param n Number of work items, such as elements or buckets.
+        * @param threads Maximum number of threads, 0 for one per hardware thread.
+        * @return size_t At least 1, and at most one thread per 16K items.
+        */
+        static size_t chunk_count(size_t n, size_t threads) {
+            constexpr size_t min_chunk = 1 << 14;// Below this, starting a thread costs more than it saves
+            if (threads == 0)
+                threads = std::max(1u, std::thread::hardware_concurrency());
+            return std::max<size_t>(1, std::min(threads, (n + min_chunk - 1) / min_chunk));
+        }
+
+        /**
+        * @brief Splits [0, n) into contiguous chunks and processes each on its own thread.
+        *
+        * A single chunk runs on the calling thread. An exception thrown by work
+        * is rethrown on the calling thread once every chunk has finished.
+        *
+        * @param n Number of work items.
+        * @param chunks Number of chunks, as returned by chunk_count().
+        * @param work Callable as work(size_t chunk, size_t begin, size_t end).
+        */
+        template<typename F>
+        static void run_chunks(size_t n, size_t chunks, F &&work) {
+            if (chunks <= 1) {
+                work(0, 0, n);
+                return;
+            }
+
+            vector<std::thread> workers;
+            vector<std::exception_ptr> errors(chunks);
+            const size_t chunk = (n + chunks - 1) / chunks;
+            for (size_t t = 0; t < chunks; ++t) {
+                workers.push_back(std::thread([&, t] {
+                    try {
+                        work(t, std::min(n, t * chunk), std::min(n, (t + 1) * chunk));
+                    } catch (...) {
+                        errors[t] = std::current_exception();
+                    }
+                }));
+            }
+            for (auto &worker: workers)
+                worker.join();
+            for (auto &error: errors)
+                if (error)
+                    std::rethrow_exception(error);
+        }
+
+        /**
+        * @brief Checks if rehashing is needed and performs it if necessary.
+        *
+        * In incremental mode this also advances a pending migration, and growth
+        * only allocates the new bucket array; the elements follow over the next
+        * operations. If the table fills up again before the previous migration
+        * is done, that migration is finished first.
+        */
+        void check_for_rehash() {
+            advance_rehash();
+            if (load_factor() <= max_load_factor_)
+                return;
+            if (rehash_step_ == 0) {
+                rehash(buckets.size() * 2);
+                return;
+            }
+            finish_rehash();
+            counters.record_rehash();
+            counters.record_allocation();
+            old_buckets = std::move(buckets);
+            buckets = make_buckets(old_buckets.size() * 2, storage.allocator());
+            migrate_index = 0;
+        }
+
+    public:
+        /**
+        * @brief Constructs a new HashMap object.
+        *
+        * @param initial_bucket_count Initial number of buckets (default is 16).
+        * @param hash Hash function object (default is Hash()).
+        */
+        explicit HashMap(size_t initial_bucket_count = 16, const Hash &hash = Hash())
+            : buckets(make_buckets(BucketPolicy::bucket_count(initial_bucket_count), storage.allocator())), migrate_index(0), rehash_step_(0),
+              size_(0), max_load_factor_(0.75f), hasher(hash) {}
+
+        /**
+        * @brief Copy constructs a HashMap; the copy allocates its nodes from its own storage.
+        *
+        * @param other The HashMap to copy, including a pending incremental rehash.
+        */
+        HashMap(const HashMap &other)
+            : buckets(copy_buckets(other.buckets, storage.allocator())),
+              old_buckets(copy_buckets(other.old_buckets, storage.allocator())),
+              migrate_index(other.migrate_index), rehash_step_(other.rehash_step_), size_(other.size_),
+              max_load_factor_(other.max_load_factor_), hasher(other.hasher), key_eq(other.key_eq) {}
+
+        /**
+        * @brief Move constructs a HashMap; nodes and their storage are taken over without copying.
+        *
+        * @param other The HashMap to move from.
+        */
+        HashMap(HashMap &&other) noexcept = default;
+
+        /**
+        * @brief Copy assignment operator.
+        *
+        * @param other The HashMap to copy.
+        * @return HashMap& Reference to this HashMap.
+        */
+        HashMap &operator=(const HashMap &other) {
+            if (this != &other)
+                *this = HashMap(other);
+            return *this;
+        }
+
+        /**
+        * @brief Move assignment operator.
+        *
+        * The current nodes are destroyed before the node storage they came from is replaced.
+        *
+        * @param other The HashMap to move from.
+        * @return HashMap& Reference to this HashMap.
+        */
+        HashMap &operator=(HashMap &&other) noexcept {
+            if (this != &other) {
+                buckets = BucketVector();
+                old_buckets = BucketVector();
+                storage = std::move(other.storage);
+                buckets = std::move(other.buckets);
+                old_buckets = std::move(other.old_buckets);
+                migrate_index = other.migrate_index;
+                rehash_step_ = other.rehash_step_;
+                size_ = other.size_;
+                max_load_factor_ = other.max_load_factor_;
+                hasher = std::move(other.hasher);
+                key_eq = std::move(other.key_eq);
+            }
+            return *this;
+        }
+
+        /**
+        * @brief Constructs a HashMap from a range of key-value pairs.
+        *
+        * See insert(first, last) for how the range is loaded.
+        *
+        * @tparam InputIt Iterator over pairs whose first and second construct Key and Value.
+        * @param first Beginning of the range.
+        * @param last End of the range.
+        * @param initial_bucket_count Minimum number of buckets (default is 16).
+        * @param hash Hash function object (default is Hash()).
+        */
+        template<std::input_iterator InputIt>
+        HashMap(InputIt first, InputIt last, size_t initial_bucket_count = 16, const Hash &hash = Hash())
+            : HashMap(initial_bucket_count, hash) {
+            insert(first, last);
+        }
+
+        /**
+        * @brief Constructs a HashMap from an initializer list of key-value pairs.
+        *
+        * @param init The pairs to insert; for repeated keys the first one wins.
+        * @param initial_bucket_count Minimum number of buckets (default is 16).
+        * @param hash Hash function object (default is Hash()).
+        */
+        HashMap(std::initializer_list<std::pair<const Key, Value>> init, size_t initial_bucket_count = 16,
+                const Hash &hash = Hash())
+            : HashMap(init.begin(), init.end(), initial_bucket_count, hash) {}
+
+        /**
+        * @brief Inserts a new element or assigns to an existing element.
+        *
+        * If the key does not exist, a new element is inserted. If the key exists,
+        * the corresponding value is updated. The value is forwarded, so an rvalue
+        * is moved into the map rather than copied.
+        *
+        * @tparam M Type of the value, convertible and assignable to Value.
+        * @param key The key of the element to insert or assign.
+        * @param value The value to be inserted or assigned.
+        *
+        * Time Complexity: Amortized O(1) on average, O(n) worst case when rehashing.
+        */
+        template<typename M>
+        void insert_or_assign(const Key &key, M &&value) {
+            auto [it, inserted] = find_or_emplace(key, std::forward<M>(value));
+            if (!inserted)
+                it->second = std::forward<M>(value);
+        }
+
+        /**
+        * @brief Inserts a new element or assigns to an existing element, moving the key.
+        *
+        * @tparam M Type of the value, convertible and assignable to Value.
+        * @param key The key, moved into the map if a new element is inserted.
+        * @param value The value to be inserted or assigned.
+        *
+        * Time Complexity: Amortized O(1) on average, O(n) worst case when rehashing.
+        */
+        template<typename M>
+        void insert_or_assign(Key &&key, M &&value) {
+            auto [it, inserted] = find_or_emplace(std::move(key), std::forward<M>(value));
+            if (!inserted)
+                it->second = std::forward<M>(value);
+        }
+
+        /**
+        * @brief Inserts an element constructed in place if the key does not exist.
+        *
+        * The value is constructed from args directly inside the new node. If the
+        * key already exists, nothing is constructed and args are left untouched.
+        *
+        * @tparam Args Types of the Value constructor arguments.
+        * @param key The key of the element.
+        * @param args Arguments forwarded to the Value constructor.
+        * @return std::pair<iterator, bool> The element with the key and whether it was inserted.
+        *
+        * Time Complexity: Amortized O(1) on average.
+        */
+        template<typename... Args>
+        std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args) {
+            return find_or_emplace(key, std::forward<Args>(args)...);
+        }
+
+        /**
+        * @brief Inserts an element constructed in place if the key does not exist, moving the key.
+        *
+        * @tparam Args Types of the Value constructor arguments.
+        * @param key The key, moved into the map only if a new element is inserted.
+        * @param args Arguments forwarded to the Value constructor.
+        * @return std::pair<iterator, bool> The element with the key and whether it was inserted.
+        *
+        * Time Complexity: Amortized O(1) on average.
+        */
+        template<typename... Args>
+        std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args) {
+            return find_or_emplace(std::move(key), std::forward<Args>(args)...);
+        }
+
+        /**
+        * @brief Inserts an element constructed in place from arbitrary pair arguments.
+        *
+        * The key-value pair is built directly in a new node, then the node is
+        * linked into its bucket if the key is not present yet, or discarded if it is.
+        * Prefer try_emplace when the key is at hand, as it does not build a node
+        * for keys that already exist.
+        *
+        * @tparam Args Types of the std::pair<const Key, Value> constructor arguments.
+        * @param args Arguments forwarded to the pair constructor.
+        * @return std::pair<iterator, bool> The element with the key and whether it was inserted.
+        *
+        * Time Complexity: Amortized O(1) on average.
+        */
+        template<typename... Args>
+        std::pair<iterator, bool> emplace(Args &&...args) {
+            Bucket node(storage.allocator());
+            Entry &entry = node.emplace_back(0, std::forward<Args>(args)...);
+            counters.record_allocation();
+            size_t hash = hasher(entry.kv.first);
+            entry.set_hash(hash);
+
+            check_for_rehash();
+            auto &bucket = locate(hash);
+            auto it = find_in_bucket(bucket, entry.kv.first, hash);
+            if (it != bucket.end())
+                return {iterator(this, position_of(bucket), it), false};
+            it = node.begin();
+            bucket.splice(bucket.end(), node, it);
+            on_linked(bucket, it);
+            ++size_;
+            return {iterator(this, position_of(bucket), it), true};
+        }
+
+        /**
+        * @brief Inserts every pair of a range whose key is not present yet.
+        *
+        * Like try_emplace, an existing element is left unchanged, and for keys
+        * repeated within the range the first occurrence wins. Elements of a
+        * move_iterator range are moved into the map.
+        *
+        * When the length of the range is known up front (forward iterators), the
+        * bucket array is grown once instead of doubling repeatedly. For random-access
+        * ranges all keys are hashed before any is placed, optionally on several
+        * threads, and each bucket is prefetched a few elements ahead of its insertion.
+        *
+        * @tparam InputIt Iterator over pairs whose first and second construct Key and Value.
+        * @param first Beginning of the range.
+        * @param last End of the range.
+        * @param threads Threads used to hash a random-access range, 0 for one per
+        *                hardware thread (default is 1). Hash must be safe to call
+        *                concurrently when this is not 1.
+        *
+        * Time Complexity: O(n) on average, where n is the length of the range.
+        */
+        template<std::input_iterator InputIt>
+        void insert(InputIt first, InputIt last, size_t threads = 1) {
+            if constexpr (std::forward_iterator<InputIt>) {
+                size_t wanted = size_ + static_cast<size_t>(std::distance(first, last));
+                if (wanted > bucket_count() * max_load_factor_)
+                    reserve(wanted);
+            }
+            if constexpr (std::random_access_iterator<InputIt>) {
+                constexpr size_t distance = 8;// Elements between a bucket's prefetch and its use
+                vector<size_t> hashes(static_cast<size_t>(last - first));
+                hash_range(first, hashes, threads);
+                for (size_t i = 0; i < hashes.size(); ++i) {
+                    if (i + distance < hashes.size())
+                        prefetch(&locate(hashes[i + distance]));
+                    auto &&item = first[i];
+                    find_or_emplace_hashed(hashes[i], std::forward<decltype(item)>(item).first,
+                                           std::forward<decltype(item)>(item).second);
+                }
+            } else {
+                for (; first != last; ++first) {
+                    auto &&item = *first;
+                    find_or_emplace(std::forward<decltype(item)>(item).first, std::forward<decltype(item)>(item).second);
+                }
+            }
+        }
+
+        /**
+        * @brief Accesses or inserts an element.
+        *
+        * Returns a reference to the value that is mapped to the key.
+        * If the key does not exist, a new element with that key and a
+        * value-initialized Value is inserted.
+        *
+        * @param key The key of the element to access or insert.
+        * @return Value& Reference to the mapped value.
+        *
+        * Time Complexity: Amortized O(1) on average.
+        */
+        Value &operator[](const Key &key) {
+            return find_or_emplace(key).first->second;
+        }
+
+        /**
+        * @brief Accesses or inserts an element, moving the key on insertion.
+        *
+        * @param key The key of the element to access or insert.
+        * @return Value& Reference to the mapped value.
+        *
+        * Time Complexity: Amortized O(1) on average.
+        */
+        Value &operator[](Key &&key) {
+            return find_or_emplace(std::move(key)).first->second;
+        }
+
+        /**
+        * @brief Accesses an element (const version).
+        *
+        * Returns a const reference to the value that is mapped to the key.
+        * If the key does not exist, throws std::out_of_range.
+        *
+        * @param key The key of the element to access.
+        * @return const Value& Const reference to the mapped value.
+        * @throw std::out_of_range if the key is not found.
+        *
+        * Time Complexity: O(1) on average.
+        */
+        const Value &at(const Key &key) const {
+            return at_key(key);
+        }
+
+        /**
+        * @brief Accesses an element by a key of another type (const version).
+        *
+        * Only available when the hash function and Policy::key_equal are both
+        * transparent; the key is hashed and compared without converting it to Key.
+        *
+        * @tparam K Type of the key, e.g. std::string_view for a map keyed by std::string.
+        * @param key The key of the element to access.
+        * @return const Value& Const reference to the mapped value.
+        * @throw std::out_of_range if the key is not found.
+        *
+        * Time Complexity: O(1) on average.
+        */
+        template<typename K>
+            requires detail::transparent_lookup<Hash, typename Policy::key_equal>
+        const Value &at(const K &key) const {
+            return at_key(key);
+        }
+
+        /**
+        * @brief Accesses an element.
+        *
+        * Returns a reference to the value that is mapped to the key.
+        * If the key does not exist, throws std::out_of_range.
+        *
+        * @param key The key of the element to access.
+        * @return Value& Reference to the mapped value.
+        * @throw std::out_of_range if the key is not found.
+        *
+        * Time Complexity: O(1) on average.
+        */
+        Value &at(const Key &key) {
+            return const_cast<Value &>(at_key(key));
+        }
+
+        /**
+        * @brief Accesses an element by a key of another type.
+        *
+        * @tparam K Type of the key; requires a transparent hash function and key_equal.
+        * @param key The key of the element to access.
+        * @return Value& Reference to the mapped value.
+        * @throw std::out_of_range if the key is not found.
+        *
+        * Time Complexity: O(1) on average.
+        */
+        template<typename K>
+            requires detail::transparent_lookup<Hash, typename Policy::key_equal>
+        Value &at(const K &key) {
+            return const_cast<Value &>(at_key(key));
+        }
+
+        /**
+        * @brief Checks if the container contains an element with the specified key.
+        *
         * @param key The key to search for.
-        * @return typename Bucket::iterator Iterator to the found element, or end iterator if not found.
+        * @return true If an element with the key exists.
+        * @return false If no element with the key exists.
+        *
+        * Time Complexity: O(1) on average.
         */
-        typename Bucket::iterator find_in_bucket(Bucket &bucket, const Key &key) {
-            return std::find_if(bucket.begin(), bucket.end(),
-                                [&key](const auto &pair) { return pair.first == key; });
+        bool contains(const Key &key) const {
+            return contains_key(key);
         }
 
         /**
-        * @brief Finds an element with the specified key in a bucket (const version).
+        * @brief Checks for an element by a key of another type, without converting it to Key.
         *
-        * @param bucket The bucket to search in.
+        * @tparam K Type of the key; requires a transparent hash function and key_equal.
         * @param key The key to search for.
-        * @return typename Bucket::const_iterator Const iterator to the found element, or end iterator if not found.
+        * @return true If an element with an equal key exists.
+        *
+        * Time Complexity: O(1) on average.
         */
-        typename Bucket::const_iterator find_in_bucket(const Bucket &bucket, const Key &key) const {
-            return std::find_if(bucket.begin(), bucket.end(),
-                                [&key](const auto &pair) { return pair.first == key; });
+        template<typename K>
+            requires detail::transparent_lookup<Hash, typename Policy::key_equal>
+        bool contains(const K &key) const {
+            return contains_key(key);
         }
 
         /**
-        * @brief Calculates the bucket index for a given key.
+        * @brief Looks up many keys at once.
         *
-        * @param key The key to hash.
-        * @return size_t The calculated bucket index.
+        * Faster than calling at() in a loop for tables that do not fit in cache,
+        * because the bucket and node loads of up to 16 keys are overlapped.
+        * Results are exactly those of calling at() for each key.
+        *
+        * @param keys The keys to look up.
+        * @param results Receives, for each key, a pointer to its value or nullptr.
+        * @return size_t The number of keys found.
+        * @throw std::invalid_argument if results is shorter than keys.
+        *
+        * Time Complexity: O(k) on average, where k is the number of keys.
         */
-        size_t bucket_index(const Key &key) const {
-            return hasher(key) % buckets.size();
+        size_t find_many(std::span<const Key> keys, std::span<const Value *> results) const {
+            if (results.size() < keys.size())
+                throw std::invalid_argument("find_many: results shorter than keys");
+            size_t found = 0;
+            resolve_batch(keys, [&](size_t i, const Entry *entry) {
+                results[i] = entry ? &entry->kv.second : nullptr;
+                found += entry != nullptr;
+            });
+            return found;
         }
 
         /**
-        * @brief Checks if rehashing is needed and performs it if necessary.
+        * @brief Looks up many keys at once, yielding mutable values.
+        *
+        * @param keys The keys to look up.
+        * @param results Receives, for each key, a pointer to its value or nullptr.
+        * @return size_t The number of keys found.
+        * @throw std::invalid_argument if results is shorter than keys.
+        *
+        * Time Complexity: O(k) on average, where k is the number of keys.
         */
-        void check_for_rehash() {
-            if (load_factor() > max_load_factor_)
-                rehash(buckets.size() * 2);
+        size_t find_many(std::span<const Key> keys, std::span<Value *> results) {
+            if (results.size() < keys.size())
+                throw std::invalid_argument("find_many: results shorter than keys");
+            size_t found = 0;
+            resolve_batch(keys, [&](size_t i, const Entry *entry) {
+                results[i] = entry ? const_cast<Value *>(&entry->kv.second) : nullptr;
+                found += entry != nullptr;
+            });
+            return found;
         }
 
-    public:
         /**
-        * @brief Constructs a new HashMap object.
+        * @brief Checks many keys for membership at once.
         *
-        * @param initial_bucket_count Initial number of buckets (default is 16).
-        * @param hash Hash function object (default is Hash()).
+        * @param keys The keys to search for.
+        * @param results Receives, for each key, whether it is present.
+        * @return size_t The number of keys found.
+        * @throw std::invalid_argument if results is shorter than keys.
+        *
+        * Time Complexity: O(k) on average, where k is the number of keys.
         */
-        explicit HashMap(size_t initial_bucket_count = 16, const Hash &hash = Hash())
-            : buckets(initial_bucket_count), size_(0), max_load_factor_(0.75f), hasher(hash) {}
+        size_t contains_many(std::span<const Key> keys, std::span<bool> results) const {
+            if (results.size() < keys.size())
+                throw std::invalid_argument("contains_many: results shorter than keys");
+            size_t found = 0;
+            resolve_batch(keys, [&](size_t i, const Entry *entry) {
+                results[i] = entry != nullptr;
+                found += entry != nullptr;
+            });
+            return found;
+        }
 
         /**
-        * @brief Inserts a new element or assigns to an existing element.
-        *
-        * If the key does not exist, a new element is inserted. If the key exists,
-        * the corresponding value is updated.
+        * @brief Removes an element with the specified key.
         *
-        * @param key The key of the element to insert or assign.
-        * @param value The value to be inserted or assigned.
+        * @param key The key of the element to remove.
+        * @return true If an element was found and removed.
+        * @return false If no element with the specified key existed.
         *
-        * Time Complexity: Amortized O(1) on average, O(n) worst case when rehashing.
+        * Time Complexity: O(1) on average.
         */
-        void insert_or_assign(const Key &key, const Value &value) {
-            check_for_rehash();
-            size_t index = bucket_index(key);
-            auto it = find_in_bucket(buckets[index], key);
-            if (it == buckets[index].end()) {
-                buckets[index].push_back(std::make_pair(key, value));
-                ++size_;
-            } else {
-                auto &pair = const_cast<std::pair<const Key, Value> &>(*it);
-                pair.second = value;
-            }
+        bool erase(const Key &key) {
+            return erase_key(key);
         }
 
         /**
-        * @brief Accesses or inserts an element.
-        *
-        * Returns a reference to the value that is mapped to the key.
-        * If the key does not exist, a new element with that key is inserted.
+        * @brief Removes an element by a key of another type, without converting it to Key.
         *
-        * @param key The key of the element to access or insert.
-        * @return Value& Reference to the mapped value.
+        * @tparam K Type of the key; requires a transparent hash function and key_equal.
+        * @param key The key of the element to remove.
+        * @return true If an element was found and removed.
         *
-        * Time Complexity: Amortized O(1) on average.
+        * Time Complexity: O(1) on average.
         */
-        Value &operator[](const Key &key) {
-            check_for_rehash();
-            size_t index = bucket_index(key);
-            auto it = find_in_bucket(buckets[index], key);
-            if (it == buckets[index].end()) {
-                auto [it, inserted] = buckets[index].push_back(std::make_pair(key, Value()));
-                ++size_;
-                return it->second;
-            }
-            return it->second;
+        template<typename K>
+            requires detail::transparent_lookup<Hash, typename Policy::key_equal> &&
+                     (!std::is_convertible_v<K, iterator>)
+        bool erase(const K &key) {
+            return erase_key(key);
         }
 
         /**
-        * @brief Accesses an element (const version).
+        * @brief Removes the element at an iterator position.
         *
-        * Returns a const reference to the value that is mapped to the key.
-        * If the key does not exist, throws std::out_of_range.
+        * Unlike the other modifiers this never advances an incremental rehash,
+        * so elements are not moved between tables and the returned iterator can
+        * be used to keep erasing while iterating:
+        * @code
+        * for (auto it = map.begin(); it != map.end();)
+        *     it = expired(*it) ? map.erase(it) : ++it;
+        * @endcode
         *
-        * @param key The key of the element to access.
-        * @return const Value& Const reference to the mapped value.
-        * @throw std::out_of_range if the key is not found.
+        * @param pos Iterator to the element to remove; must be dereferenceable.
+        * @return iterator Iterator to the element following the removed one.
         *
-        * Time Complexity: O(1) on average.
+        * Time Complexity: O(1) on average; finding the next element may skip empty buckets.
         */
-        const Value &at(const Key &key) const {
-            size_t index = bucket_index(key);
-            auto it = find_in_bucket(buckets[index], key);
-            if (it == buckets[index].end())
-                throw std::out_of_range("Key not found in HashMap");
-            return it->second;
+        iterator erase(iterator pos) {
+            Bucket &bucket = bucket_at(pos.bucket_index);
+            on_unlinking(bucket, pos.bucket_it);
+            auto next = bucket.erase(pos.bucket_it);
+            --size_;
+            return iterator(this, pos.bucket_index, next);
         }
 
         /**
-        * @brief Accesses an element.
-        *
-        * Returns a reference to the value that is mapped to the key.
-        * If the key does not exist, throws std::out_of_range.
+        * @brief Finds an element with the specified key.
         *
-        * @param key The key of the element to access.
-        * @return Value& Reference to the mapped value.
-        * @throw std::out_of_range if the key is not found.
+        * @param key The key to search for.
+        * @return iterator Iterator to the element, or end() if the key is not present.
         *
         * Time Complexity: O(1) on average.
         */
-        Value &at(const Key &key) {
-            return const_cast<Value &>(static_cast<const HashMap *>(this)->at(key));
+        iterator find(const Key &key) {
+            return find_key(key);
         }
 
         /**
-        * @brief Checks if the container contains an element with the specified key.
+        * @brief Finds an element by a key of another type, without converting it to Key.
         *
+        * @tparam K Type of the key; requires a transparent hash function and key_equal.
         * @param key The key to search for.
-        * @return true If an element with the key exists.
-        * @return false If no element with the key exists.
+        * @return iterator Iterator to the element, or end() if the key is not present.
         *
         * Time Complexity: O(1) on average.
         */
-        bool contains(const Key &key) const {
-            size_t index = bucket_index(key);
-            return find_in_bucket(buckets[index], key) != buckets[index].end();
+        template<typename K>
+            requires detail::transparent_lookup<Hash, typename Policy::key_equal>
+        iterator find(const K &key) {
+            return find_key(key);
         }
 
         /**
-        * @brief Removes an element with the specified key.
+        * @brief Finds an element with the specified key (const version).
         *
-        * @param key The key of the element to remove.
-        * @return true If an element was found and removed.
-        * @return false If no element with the specified key existed.
+        * @param key The key to search for.
+        * @return const_iterator Iterator to the element, or end() if the key is not present.
         *
         * Time Complexity: O(1) on average.
         */
-        bool erase(const Key &key) {
-            size_t index = bucket_index(key);
-            auto &bucket = buckets[index];
-            auto it = find_in_bucket(bucket, key);
-            if (it != bucket.end()) {
-                bucket.remove(*it);
-                --size_;
-                return true;
-            }
-            return false;
+        const_iterator find(const Key &key) const {
+            return find_key(key);
+        }
+
+        /**
+        * @brief Finds an element by a key of another type (const version).
+        *
+        * @tparam K Type of the key; requires a transparent hash function and key_equal.
+        * @param key The key to search for.
+        * @return const_iterator Iterator to the element, or end() if the key is not present.
+        */
+        template<typename K>
+            requires detail::transparent_lookup<Hash, typename Policy::key_equal>
+        const_iterator find(const K &key) const {
+            return find_key(key);
         }
 
         /**
         * @brief Removes all elements from the container.
         *
+        * With a pooled node allocator, the node slabs are freed as a whole afterwards.
+        *
         * Time Complexity: O(n), where n is the number of elements.
         */
         void clear() {
             for (auto &bucket: buckets)
                 bucket.clear();
+            old_buckets = BucketVector();
+            migrate_index = 0;
             size_ = 0;
+            storage.release();
         }
 
         /**
@@ -255,6 +1563,8 @@ namespace userDefineDataStructure {
         /**
         * @brief Returns the number of buckets in the container.
         *
+        * During an incremental rehash this is the size of the new table.
+        *
         * @return size_t The number of buckets.
         *
         * Time Complexity: O(1)
@@ -300,25 +1610,66 @@ namespace userDefineDataStructure {
         */
         float max_load_factor() const { return max_load_factor_; }
 
+        /**
+        * @brief Enables or disables incremental rehashing.
+        *
+        * With a non-zero step, growing the table only allocates the new bucket
+        * array; each later insert or erase then migrates up to step old buckets,
+        * so no single operation pays for moving the whole table. Lookups stay
+        * O(1) during the migration because every key is in exactly one table.
+        * A step of 2 or more guarantees that a migration completes before the
+        * table needs to grow again. A step of 0 restores blocking rehashes and
+        * finishes any migration in progress.
+        *
+        * @param step Number of old buckets migrated per mutating operation.
+        *
+        * Time Complexity: O(1), or O(n) when finishing a pending migration.
+        */
+        void incremental_rehash(size_t step) {
+            rehash_step_ = step;
+            if (step == 0)
+                finish_rehash();
+        }
+
+        /**
+        * @brief Returns the number of buckets migrated per operation.
+        *
+        * @return size_t The incremental rehash step, 0 if rehashing is blocking.
+        */
+        size_t incremental_rehash() const { return rehash_step_; }
+
+        /**
+        * @brief Checks if an incremental rehash is still migrating buckets.
+        *
+        * @return true If elements remain in the old bucket array.
+        */
+        bool rehash_in_progress() const { return !old_buckets.empty(); }
+
         /**
         * @brief Changes the number of buckets and rehashes all elements.
         *
-        * @param new_bucket_count The new number of buckets.
+        * This is always a blocking operation; a pending incremental rehash is
+        * completed first. Existing nodes are relinked into the new buckets, so
+        * the only allocation is the new bucket array and references to elements
+        * remain valid.
+        *
+        * @param new_bucket_count The new number of buckets, adjusted by the bucket policy.
         *
         * Time Complexity: O(n), where n is the number of elements.
         */
         void rehash(size_t new_bucket_count) {
+            finish_rehash();
             if (new_bucket_count < size_ / max_load_factor_)
                 new_bucket_count = static_cast<size_t>(std::ceil(size_ / max_load_factor_));
+            new_bucket_count = BucketPolicy::bucket_count(new_bucket_count);
 
-            BucketVector new_buckets(new_bucket_count);
+            counters.record_rehash();
+            counters.record_allocation();
+            [[maybe_unused]] auto timer = counters.time_rehash();
+            BucketVector new_buckets = make_buckets(new_bucket_count, storage.allocator());
 
-            for (const auto &bucket: buckets) {
-                for (const auto &pair: bucket) {
-                    size_t new_index = hasher(pair.first) % new_bucket_count;
-                    new_buckets[new_index].push_back(pair);
-                }
-            }
+            for (auto &bucket: buckets)
+                move_nodes(bucket, new_buckets);
 
             buckets = std::move(new_buckets);
         }
@@ -334,15 +1685,18 @@ namespace userDefineDataStructure {
             size_t bucket_index;
             typename Bucket::iterator bucket_it;
 
+            friend class HashMap;
+            friend class const_iterator;
+
             /**
             * @brief Finds the next valid element in the HashMap.
             */
             void find_next_valid() {
-                while (bucket_index < map->bucket_count() &&
-                       bucket_it == map->buckets[bucket_index].end()) {
+                while (bucket_index < map->total_buckets() &&
+                       bucket_it == map->bucket_at(bucket_index).end()) {
                     ++bucket_index;
-                    if (bucket_index < map->bucket_count())
-                        bucket_it = map->buckets[bucket_index].begin();
+                    if (bucket_index < map->total_buckets())
+                        bucket_it = map->bucket_at(bucket_index).begin();
                 }
             }
 
@@ -351,7 +1705,7 @@ namespace userDefineDataStructure {
             * @brief Constructs an iterator.
             *
             * @param m Pointer to the HashMap.
-            * @param bi Current bucket index.
+            * @param bi Current bucket index, counting the old table first during an incremental rehash.
             * @param it Iterator within the current bucket.
             */
             iterator(HashMap *m, size_t bi, typename Bucket::iterator it)
@@ -364,14 +1718,14 @@ namespace userDefineDataStructure {
             *
             * @return std::pair<const Key, Value>& Reference to the current key-value pair.
             */
-            std::pair<const Key, Value> &operator*() { return *bucket_it; }
+            std::pair<const Key, Value> &operator*() { return bucket_it->kv; }
 
             /**
             * @brief Arrow operator.
             *
             * @return std::pair<const Key, Value>* Pointer to the current key-value pair.
             */
-            std::pair<const Key, Value> *operator->() { return &(*bucket_it); }
+            std::pair<const Key, Value> *operator->() { return &bucket_it->kv; }
 
             /**
             * @brief Prefix increment operator.
@@ -393,7 +1747,7 @@ namespace userDefineDataStructure {
             */
             bool operator==(const iterator &other) const {
                 return map == other.map && bucket_index == other.bucket_index &&
-                       (bucket_index == map->bucket_count() || bucket_it == other.bucket_it);
+                       (bucket_index == map->total_buckets() || bucket_it == other.bucket_it);
             }
 
             /**
@@ -408,6 +1762,101 @@ namespace userDefineDataStructure {
             }
         };
 
+        /**
+        * @brief Read-only iterator class for HashMap.
+        *
+        * Visits elements in the same order as iterator; an iterator converts to a const_iterator.
+        */
+        class const_iterator {
+        private:
+            const HashMap *map;
+            size_t bucket_index;
+            typename Bucket::const_iterator bucket_it;
+
+            friend class HashMap;
+
+            /**
+            * @brief Finds the next valid element in the HashMap.
+            */
+            void find_next_valid() {
+                while (bucket_index < map->total_buckets() &&
+                       bucket_it == map->bucket_at(bucket_index).end()) {
+                    ++bucket_index;
+                    if (bucket_index < map->total_buckets())
+                        bucket_it = map->bucket_at(bucket_index).begin();
+                }
+            }
+
+        public:
+            /**
+            * @brief Constructs a const_iterator.
+            *
+            * @param m Pointer to the HashMap.
+            * @param bi Current bucket index, counting the old table first during an incremental rehash.
+            * @param it Iterator within the current bucket.
+            */
+            const_iterator(const HashMap *m, size_t bi, typename Bucket::const_iterator it)
+                : map(m), bucket_index(bi), bucket_it(it) {
+                find_next_valid();
+            }
+
+            /**
+            * @brief Converts a mutable iterator to a const_iterator.
+            *
+            * @param it The iterator to convert from.
+            */
+            const_iterator(const iterator &it)
+                : map(it.map), bucket_index(it.bucket_index), bucket_it(it.bucket_it) {}
+
+            /**
+            * @brief Dereference operator.
+            *
+            * @return const std::pair<const Key, Value>& Reference to the current key-value pair.
+            */
+            const std::pair<const Key, Value> &operator*() const { return bucket_it->kv; }
+
+            /**
+            * @brief Arrow operator.
+            *
+            * @return const std::pair<const Key, Value>* Pointer to the current key-value pair.
+            */
+            const std::pair<const Key, Value> *operator->() const { return &bucket_it->kv; }
+
+            /**
+            * @brief Prefix increment operator.
+            *
+            * @return const_iterator& Reference to the incremented iterator.
+            */
+            const_iterator &operator++() {
+                ++bucket_it;
+                find_next_valid();
+                return *this;
+            }
+
+            /**
+            * @brief Equality comparison operator.
+            *
+            * @param other The iterator to compare with.
+            * @return true If the iterators are equal.
+            * @return false If the iterators are not equal.
+            */
+            bool operator==(const const_iterator &other) const {
+                return map == other.map && bucket_index == other.bucket_index &&
+                       (bucket_index == map->total_buckets() || bucket_it == other.bucket_it);
+            }
+
+            /**
+            * @brief Inequality comparison operator.
+            *
+            * @param other The iterator to compare with.
+            * @return true If the iterators are not equal.
+            * @return false If the iterators are equal.
+            */
+            bool operator!=(const const_iterator &other) const {
+                return !(*this == other);
+            }
+        };
+
         /**
         * @brief Returns an iterator to the beginning of the HashMap.
         *
@@ -416,9 +1865,9 @@ namespace userDefineDataStructure {
         * Time Complexity: O(n) in the worst case, where n is the number of buckets.
         */
         iterator begin() {
-            for (size_t i = 0; i < bucket_count(); ++i) {
-                if (!buckets[i].empty())
-                    return iterator(this, i, buckets[i].begin());
+            for (size_t i = 0; i < total_buckets(); ++i) {
+                if (!bucket_at(i).empty())
+                    return iterator(this, i, bucket_at(i).begin());
             }
             return end();
         }
@@ -431,7 +1880,131 @@ namespace userDefineDataStructure {
         * Time Complexity: O(1)
         */
         iterator end() {
-            return iterator(this, bucket_count(), typename Bucket::iterator(nullptr));
+            return iterator(this, total_buckets(), typename Bucket::iterator(nullptr));
+        }
+
+        /**
+        * @brief Returns a const_iterator to the beginning of the HashMap.
+        *
+        * @return const_iterator Iterator pointing to the first element.
+        *
+        * Time Complexity: O(n) in the worst case, where n is the number of buckets.
+        */
+        const_iterator begin() const {
+            for (size_t i = 0; i < total_buckets(); ++i) {
+                if (!bucket_at(i).empty())
+                    return const_iterator(this, i, bucket_at(i).begin());
+            }
+            return end();
+        }
+
+        /**
+        * @brief Returns a const_iterator to the end of the HashMap.
+        *
+        * @return const_iterator Iterator pointing to the position one past the last element.
+        *
+        * Time Complexity: O(1)
+        */
+        const_iterator end() const {
+            return const_iterator(this, total_buckets(), typename Bucket::const_iterator(nullptr));
+        }
+
+        /**
+        * @brief Returns a const_iterator to the beginning, even on a mutable HashMap.
+        */
+        const_iterator cbegin() const { return begin(); }
+
+        /**
+        * @brief Returns a const_iterator to the end, even on a mutable HashMap.
+        */
+        const_iterator cend() const { return end(); }
+
+        /**
+        * @brief Calls a function on every element, splitting the buckets across threads.
+        *
+        * Each thread walks a contiguous range of buckets directly, so a full scan
+        * neither goes through iterator nor skips empty buckets one at a time on a
+        * single core. Elements are visited in no particular order. The map must
+        * not be modified during the call, and f must be safe to call concurrently
+        * on different elements.
+        *
+        * @tparam F Callable as f(std::pair<const Key, Value> &).
+        * @param f The function to apply.
+        * @param threads Maximum number of threads, 0 for one per hardware thread.
+        * @throw Rethrows the first exception thrown by f, after all threads finished.
+        *
+        * Time Complexity: O(n + b) work, where b is the number of buckets, divided across the threads.
+        */
+        template<typename F>
+        void parallel_for_each(F &&f, size_t threads = 0) {
+            const size_t n = total_buckets();
+            run_chunks(n, chunk_count(n, threads), [&](size_t, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i)
+                    for (auto &entry: bucket_at(i))
+                        f(entry.kv);
+            });
+        }
+
+        /**
+        * @brief Calls a function on every element, splitting the buckets across threads (const version).
+        *
+        * @tparam F Callable as f(const std::pair<const Key, Value> &).
+        * @param f The function to apply.
+        * @param threads Maximum number of threads, 0 for one per hardware thread.
+        */
+        template<typename F>
+        void parallel_for_each(F &&f, size_t threads = 0) const {
+            const size_t n = total_buckets();
+            run_chunks(n, chunk_count(n, threads), [&](size_t, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i)
+                    for (const auto &entry: bucket_at(i))
+                        f(entry.kv);
+            });
+        }
+
+        /**
+        * @brief Maps every element to a value and combines the results, splitting the buckets across threads.
+        *
+        * Each thread folds its range of buckets into a partial result; the partial
+        * results are then folded into init in bucket order. reduce must therefore
+        * be associative, but need not be commutative.
+        * @code
+        * size_t total = orders.parallel_reduce(size_t(0),
+        *     [](const auto &pair) { return pair.second.quantity; }, std::plus<>());
+        * @endcode
+        *
+        * @tparam T The result type.
+        * @tparam Transform Callable as transform(const std::pair<const Key, Value> &), returning a T.
+        * @tparam Reduce Callable as reduce(T, T), returning a T.
+        * @param init The initial value, combined exactly once.
+        * @param transform Maps an element to a T.
+        * @param reduce Combines two T values.
+        * @param threads Maximum number of threads, 0 for one per hardware thread.
+        * @return T init combined with the transform of every element.
+        * @throw Rethrows the first exception thrown by transform or reduce.
+        *
+        * Time Complexity: O(n + b) work divided across the threads, plus O(threads) to combine.
+        */
+        template<typename T, typename Transform, typename Reduce>
+        T parallel_reduce(T init, Transform &&transform, Reduce &&reduce, size_t threads = 0) const {
+            const size_t n = total_buckets();
+            const size_t chunks = chunk_count(n, threads);
+            vector<std::optional<T>> partials(chunks);
+            run_chunks(n, chunks, [&](size_t chunk, size_t begin, size_t end) {
+                std::optional<T> &partial = partials[chunk];
+                for (size_t i = begin; i < end; ++i) {
+                    for (const auto &entry: bucket_at(i)) {
+                        if (partial)
+                            partial = reduce(std::move(*partial), transform(entry.kv));
+                        else
+                            partial.emplace(transform(entry.kv));
+                    }
+                }
+            });
+            for (auto &partial: partials)
+                if (partial)
+                    init = reduce(std::move(init), std::move(*partial));
+            return init;
         }
 
         /**
@@ -461,6 +2034,58 @@ namespace userDefineDataStructure {
             return buckets[n].size();
         }
 
+        /**
+        * @brief Returns a snapshot of the collected statistics.
+        *
+        * Only available when Policy::collect_stats is true. The counters are
+        * read in O(1); the chain-length histogram is built by visiting every bucket.
+        *
+        * @return HashMapStats The current statistics.
+        *
+        * Time Complexity: O(b), where b is the number of buckets.
+        */
+        HashMapStats stats() const
+            requires Policy::collect_stats
+        {
+            HashMapStats result;
+            result.lookups = counters.lookups.load(std::memory_order_relaxed);
+            result.comparisons = counters.comparisons.load(std::memory_order_relaxed);
+            result.max_comparisons = counters.max_comparisons.load(std::memory_order_relaxed);
+            result.rehashes = counters.rehashes.load(std::memory_order_relaxed);
+            result.rehash_time = std::chrono::nanoseconds(counters.rehash_nanos.load(std::memory_order_relaxed));
+            result.allocations = counters.allocations.load(std::memory_order_relaxed);
+            for (const BucketVector *table: {&old_buckets, &buckets}) {
+                for (const auto &bucket: *table) {
+                    if (bucket.size() >= result.chain_length_histogram.size())
+                        result.chain_length_histogram.resize(bucket.size() + 1);
+                    ++result.chain_length_histogram[bucket.size()];
+                }
+            }
+            return result;
+        }
+
+        /**
+        * @brief Zeroes the statistics counters.
+        *
+        * Only available when Policy::collect_stats is true.
+        */
+        void reset_stats()
+            requires Policy::collect_stats
+        {
+            counters.reset();
+        }
+
+        /**
+        * @brief Returns the pool the entry nodes are allocated from.
+        *
+        * Only available when Policy::node_allocator draws from a pool, such as PoolNodeAllocator.
+        */
+        const auto &node_pool() const
+            requires requires { typename NodeAllocator::pool_type; }
+        {
+            return *storage.pool;
+        }
+
         /**
         * @brief Returns the hash function object used by the container.
         *
@@ -472,6 +2097,28 @@ namespace userDefineDataStructure {
             return hasher;
         }
 
+        /**
+        * @brief Copies the contents into an immutable, perfectly hashed map.
+        *
+        * Meant for tables that are built once and then only read: the result
+        * stores all entries contiguously and answers every lookup with a single
+        * probe. This map is left unchanged.
+        *
+        * @return FrozenHashMap<Key, Value, Hash> A read-only copy using the same hash function.
+        * @throw std::invalid_argument if two distinct keys have equal hashes.
+        *
+        * Time Complexity: Expected O(n log n), where n is the number of elements.
+        */
+        FrozenHashMap<Key, Value, Hash> freeze() const {
+            vector<std::pair<Key, Value>> items;
+            items.reserve(size_);
+            for (const BucketVector *table: {&old_buckets, &buckets})
+                for (const auto &bucket: *table)
+                    for (const auto &entry: bucket)
+                        items.push_back(std::pair<Key, Value>(entry.kv));
+            return FrozenHashMap<Key, Value, Hash>(std::move(items), hasher);
+        }
+
         /**
         * @brief Reserves space for at least the specified number of elements.
         *
@@ -482,8 +2129,6 @@ namespace userDefineDataStructure {
         void reserve(size_t count) {
             rehash(std::ceil(count / max_load_factor()));
         }
-
-        // You might want to add const_iterator support as well, similar to the iterator class
     };
 
 }// namespace userDefineDataStructure
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <concepts>
 #include <initializer_list>
 #include <memory>
 #include <stdexcept>
@@ -15,10 +16,13 @@
  * memory management and provides both const and non-const iterators.
  * 
  * @tparam T The type of elements stored in the list.
+ * @tparam NodeAllocator How nodes are allocated; HeapNodeAllocator (the default)
+ *         or PoolNodeAllocator (node_pool.h).
  * 
  * Key features:
  * - Constant time insertion and removal of elements at both ends
  * - Linear time insertion and removal of elements at arbitrary positions
+ * - Constant time splicing of nodes between lists without copying elements
  * - Bidirectional iteration
  * - Exception safety (basic guarantee for most operations)
  * - Move semantics support
@@ -42,20 +46,50 @@
 
 namespace userDefineDataStructure {
 
+    /**
+    * @brief List node allocator that creates every node with new and destroys it with delete.
+    *
+    * A node allocator provides create<Node>(args...) and a static
+    * destroy(Node *). Because destroy is static, the smart pointers linking
+    * the nodes need no per-node allocator state.
+    */
+    struct HeapNodeAllocator {
+        template<typename Node, typename... Args>
+        Node *create(Args &&...args) { return new Node(std::forward<Args>(args)...); }
+
+        template<typename Node>
+        static void destroy(Node *node) { delete node; }
+
+        bool operator==(const HeapNodeAllocator &) const = default;
+    };
+
     /**
     * @brief A doubly linked list implementation.
     * 
     * @tparam T The type of elements stored in the list.
+    * @tparam NodeAllocator How nodes are allocated. Lists may only splice nodes
+    *         between each other if their allocators compare equal.
     */
-    template<typename T>
+    template<typename T, typename NodeAllocator = HeapNodeAllocator>
     class List {
     private:
+        struct Node;
+
+        /**
+        * @brief Releases a node through the allocator that created it.
+        */
+        struct NodeDeleter {
+            void operator()(Node *node) const { NodeAllocator::destroy(node); }
+        };
+
+        using NodePtr = std::unique_ptr<Node, NodeDeleter>;///< Owning link to a node
+
         /**
         * @brief Node structure for the linked list.
         */
         struct Node {
-            T data;                    ///< Data stored in the node
-            std::unique_ptr<Node> next;///< Smart pointer to the next node
+            T data;      ///< Data stored in the node
+            NodePtr next;///< Smart pointer to the next node
             Node *prev;                ///< Raw pointer to the previous node
 
             /**
@@ -77,16 +111,86 @@ namespace userDefineDataStructure {
                 : data(std::forward<Args>(args)...), next(nullptr), prev(nullptr) {}
         };
 
-        std::unique_ptr<Node> head;///< Smart pointer to the first node
-        Node *tail;                ///< Raw pointer to the last node
-        size_t list_size;          ///< Current size of the list
+        NodePtr head;     ///< Smart pointer to the first node
+        Node *tail;       ///< Raw pointer to the last node
+        size_t list_size; ///< Current size of the list
+        [[no_unique_address]] NodeAllocator allocator;///< Creates the nodes
+
+        /**
+        * @brief Creates a detached node holding a T constructed from args.
+        */
+        template<typename... Args>
+        NodePtr make_node(Args &&...args) {
+            return NodePtr(allocator.template create<Node>(std::forward<Args>(args)...));
+        }
+
+        /**
+        * @brief Detach a node from the list without destroying it.
+        *
+        * @param node The node to detach; must belong to this list.
+        * @return NodePtr Ownership of the detached node.
+        */
+        NodePtr unlink(Node *node) {
+            NodePtr owned;
+            if (node->prev) {
+                owned = std::move(node->prev->next);
+                node->prev->next = std::move(node->next);
+            } else {
+                owned = std::move(head);
+                head = std::move(node->next);
+            }
+            Node *next = node->prev ? node->prev->next.get() : head.get();
+            if (next)
+                next->prev = node->prev;
+            else
+                tail = node->prev;
+            node->prev = nullptr;
+            --list_size;
+            return owned;
+        }
+
+        /**
+        * @brief Link a detached node into the list before a position.
+        *
+        * @param pos The node to insert before, or nullptr to append.
+        * @param node The detached node to link in.
+        * @return Node* The linked node.
+        */
+        Node *link_before(Node *pos, NodePtr node) {
+            Node *raw = node.get();
+            if (!pos) {
+                raw->prev = tail;
+                if (tail)
+                    tail->next = std::move(node);
+                else
+                    head = std::move(node);
+                tail = raw;
+            } else {
+                raw->prev = pos->prev;
+                NodePtr &slot = pos->prev ? pos->prev->next : head;
+                raw->next = std::move(slot);
+                slot = std::move(node);
+                pos->prev = raw;
+            }
+            ++list_size;
+            return raw;
+        }
 
     public:
         /**
         * @brief Construct a new empty List object.
         */
         List()
-            : head(nullptr), tail(nullptr), list_size(0) {}
+            requires std::default_initializable<NodeAllocator>
+            : List(NodeAllocator()) {}
+
+        /**
+        * @brief Construct a new empty List object that allocates nodes through an allocator.
+        *
+        * @param alloc The node allocator.
+        */
+        explicit List(const NodeAllocator &alloc)
+            : head(nullptr), tail(nullptr), list_size(0), allocator(alloc) {}
 
         /**
         * @brief Destroy the List object and free all nodes.
@@ -101,20 +205,29 @@ namespace userDefineDataStructure {
         * @param other The List to be copied.
         */
         List(const List &other)
-            : List() {
+            : List(other, other.allocator) {}
+
+        /**
+        * @brief Copy construct a new List object that allocates nodes through another allocator.
+        *
+        * @param other The List to be copied.
+        * @param alloc The node allocator of the copy.
+        */
+        List(const List &other, const NodeAllocator &alloc)
+            : List(alloc) {
             for (const auto &value: other)
                 push_back(value);
         }
 
         /**
-        * @brief Copy assignment operator.
+        * @brief Copy assignment operator; this List keeps its own allocator.
         * 
         * @param other The List to be copied.
         * @return List& Reference to this List.
         */
         List &operator=(const List &other) {
             if (this != &other) {
-                List temp(other);
+                List temp(other, allocator);
                 swap(temp);
             }
             return *this;
@@ -126,7 +239,7 @@ namespace userDefineDataStructure {
         * @param other The List to be moved from.
         */
         List(List &&other) noexcept
-            : head(std::move(other.head)), tail(other.tail), list_size(other.list_size) {
+            : head(std::move(other.head)), tail(other.tail), list_size(other.list_size), allocator(other.allocator) {
             other.tail = nullptr;
             other.list_size = 0;
         }
@@ -143,6 +256,7 @@ namespace userDefineDataStructure {
                 head = std::move(other.head);
                 tail = other.tail;
                 list_size = other.list_size;
+                allocator = other.allocator;
 
                 other.tail = nullptr;
                 other.list_size = 0;
@@ -156,6 +270,7 @@ namespace userDefineDataStructure {
         * @param init The initializer list to construct from.
         */
         List(std::initializer_list<T> init)
+            requires std::default_initializable<NodeAllocator>
             : List() {
             for (const auto &item: init)
                 push_back(item);
@@ -167,7 +282,7 @@ namespace userDefineDataStructure {
          * @param value The value to be added.
         */
         void push_back(const T &value) {
-            auto new_node = std::make_unique<Node>(value);
+            auto new_node = make_node(value);
             Node *new_node_ptr = new_node.get();
 
             if (!tail) {
@@ -181,13 +296,39 @@ namespace userDefineDataStructure {
             ++list_size;
         }
 
+        /**
+        * @brief Add an element to the end of the list by moving it.
+        *
+        * @param value The value to be moved into the list.
+        */
+        void push_back(T &&value) {
+            emplace_back(std::move(value));
+        }
+
+        /**
+        * @brief Construct an element in place at the end of the list.
+        *
+        * The arguments are forwarded straight to the constructor of T inside the
+        * new node, so no temporary T is created.
+        *
+        * @tparam Args Types of the constructor arguments.
+        * @param args Arguments to be forwarded to the T constructor.
+        * @return T& Reference to the new element.
+        *
+        * Time Complexity: O(1)
+        */
+        template<typename... Args>
+        T &emplace_back(Args &&...args) {
+            return link_before(nullptr, make_node(std::forward<Args>(args)...))->data;
+        }
+
         /**
          * @brief Add an element to the beginning of the list.
         * 
         * @param value The value to be added.
         */
         void push_front(const T &value) {
-            auto new_node = std::make_unique<Node>(value);
+            auto new_node = make_node(value);
             Node *new_node_ptr = new_node.get();
 
             if (!head) {
@@ -233,9 +374,14 @@ namespace userDefineDataStructure {
 
         /**
         * @brief Remove all elements from the list.
+        *
+        * Nodes are released front to back one at a time; resetting the head
+        * directly would destroy the chain recursively and could overflow the
+        * stack for long lists.
         */
         void clear() {
-            head.reset();
+            while (head)
+                head = std::move(head->next);
             tail = nullptr;
             list_size = 0;
         }
@@ -364,8 +510,14 @@ namespace userDefineDataStructure {
             swap(head, other.head);
             swap(tail, other.tail);
             swap(list_size, other.list_size);
+            swap(allocator, other.allocator);
         }
 
+        /**
+        * @brief Returns the node allocator.
+        */
+        NodeAllocator get_allocator() const { return allocator; }
+
         /**
         * @brief Iterator class for traversing the list.
         */
@@ -384,9 +536,9 @@ namespace userDefineDataStructure {
             /**
             * @brief Construct a new iterator object.
             * 
-            * @param node Pointer to the current node.
+            * @param node Pointer to the current node (default is nullptr, the end position).
             */
-            explicit iterator(Node *node)
+            explicit iterator(Node *node = nullptr)
                 : current(node) {}
 
             /**
@@ -615,6 +767,116 @@ namespace userDefineDataStructure {
         * @return const_iterator Const iterator pointing one past the last element.
         */
         const_iterator cend() const { return const_iterator(nullptr); }
+
+        /**
+        * @brief Construct an element in place before a position.
+        *
+        * @tparam Args Types of the constructor arguments.
+        * @param pos Position before which the element is constructed.
+        * @param args Arguments to be forwarded to the T constructor.
+        * @return iterator Iterator to the new element.
+        *
+        * Time Complexity: O(1)
+        */
+        template<typename... Args>
+        iterator emplace(const_iterator pos, Args &&...args) {
+            return iterator(link_before(const_cast<Node *>(pos.current), make_node(std::forward<Args>(args)...)));
+        }
+
+        /**
+        * @brief Remove the element at a position.
+        *
+        * Only the removed element is destroyed; iterators to other elements
+        * stay valid.
+        *
+        * @param pos Iterator to the element to remove; must be dereferenceable.
+        * @return iterator Iterator to the element that followed the removed one.
+        *
+        * Time Complexity: O(1)
+        */
+        iterator erase(const_iterator pos) {
+            Node *node = const_cast<Node *>(pos.current);
+            Node *next = node->next.get();
+            unlink(node);
+            return iterator(next);
+        }
+
+        /**
+        * @brief Move a single element from another list into this one.
+        *
+        * The node itself is relinked, so no element is copied or moved and no
+        * memory is allocated. References and iterators to the element stay valid
+        * and now refer into this list. other may be *this.
+        *
+        * @param pos Position before which the element is inserted.
+        * @param other The list the element currently belongs to.
+        * @param it Iterator to the element to move.
+        *
+        * Time Complexity: O(1)
+        */
+        void splice(const_iterator pos, List &other, const_iterator it) {
+            if (pos == it) return;
+            Node *node = const_cast<Node *>(it.current);
+            link_before(const_cast<Node *>(pos.current), other.unlink(node));
+        }
+
+        /**
+        * @brief Move a single element from another list into this one.
+        *
+        * @param pos Position before which the element is inserted.
+        * @param other The list the element currently belongs to.
+        * @param it Iterator to the element to move.
+        */
+        void splice(const_iterator pos, List &&other, const_iterator it) {
+            splice(pos, other, it);
+        }
+
+        /**
+        * @brief Move all elements of another list into this one.
+        *
+        * The whole chain of other is relinked in one step and other becomes empty.
+        *
+        * @param pos Position before which the elements are inserted.
+        * @param other The list to take the elements from; must not be *this.
+        *
+        * Time Complexity: O(1)
+        */
+        void splice(const_iterator pos, List &other) {
+            if (&other == this || other.empty()) return;
+            Node *first = other.head.get();
+            Node *last = other.tail;
+            NodePtr chain = std::move(other.head);
+            size_t count = other.list_size;
+            other.tail = nullptr;
+            other.list_size = 0;
+
+            Node *next = const_cast<Node *>(pos.current);
+            if (!next) {
+                first->prev = tail;
+                if (tail)
+                    tail->next = std::move(chain);
+                else
+                    head = std::move(chain);
+                tail = last;
+            } else {
+                first->prev = next->prev;
+                NodePtr &slot = next->prev ? next->prev->next : head;
+                last->next = std::move(slot);
+                slot = std::move(chain);
+                next->prev = last;
+            }
+            list_size += count;
+        }
+
+        /**
+        * @brief Move all elements of another list into this one.
+        *
+        * @param pos Position before which the elements are inserted.
+        * @param other The list to take the elements from.
+        */
+        void splice(const_iterator pos, List &&other) {
+            splice(pos, other);
+        }
     };
 
     /**
@@ -624,11 +886,12 @@ namespace userDefineDataStructure {
     * provides a convenient way to swap two List objects.
     * 
     * @tparam T The type of elements stored in the list.
+    * @tparam NodeAllocator The node allocator type.
     * @param lhs The first List to swap.
     * @param rhs The second List to swap.
     */
-    template<typename T>
-    void swap(List<T> &lhs, List<T> &rhs) noexcept {
+    template<typename T, typename NodeAllocator>
+    void swap(List<T, NodeAllocator> &lhs, List<T, NodeAllocator> &rhs) noexcept {
         lhs.swap(rhs);
     }
 
@@ -0,0 +1,272 @@
+#pragma once
+
+#include "hash_table.h"
+#include "list.h"
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @class LRUCache
+ * @brief A least-recently-used cache built on HashMap and List.
+ *
+ * Entries are kept in a List ordered from most to least recently used, and a
+ * HashMap maps each key to its list node. A hit splices the node to the front
+ * of the list, and an insertion that exceeds the budget evicts from the back,
+ * so get, put and evict are all O(1) and never copy a cached value.
+ *
+ * @tparam Key The type of keys.
+ * @tparam Value The type of cached values.
+ * @tparam Hash The hash function type, defaults to std::hash<Key>.
+ *
+ * Key features:
+ * - Entry-count capacity and an optional byte budget, charged per entry
+ * - Hit, miss and eviction counters
+ * - Eviction callback, e.g. for write-back or metrics
+ *
+ * Usage example:
+ * @code
+ * userDefineDataStructure::LRUCache<std::string, std::string> cache(1000, 64 << 20);
+ * cache.set_eviction_callback([](const std::string &key, std::string &value) {
+ *     std::cout << "evicted " << key << std::endl;
+ * });
+ * cache.put("user:1", payload, payload.size());
+ * if (std::string *hit = cache.get("user:1"))
+ *     std::cout << *hit << std::endl;
+ * @endcode
+ *
+ * @warning This class is not thread-safe. External synchronization is required
+ *          for concurrent access; note that get() modifies the recency order.
+ */
+
+namespace userDefineDataStructure {
+    template<typename Key, typename Value, typename Hash = std::hash<Key>>
+    class LRUCache {
+    public:
+        using eviction_callback = std::function<void(const Key &, Value &)>;///< Called with each evicted entry
+
+    private:
+        /**
+        * @brief A cached entry as stored in the recency list.
+        */
+        struct Entry {
+            Key key;     ///< Copy of the key, needed to drop the index entry on eviction
+            Value value; ///< The cached value
+            size_t bytes;///< Charge of this entry against the byte budget
+        };
+
+        using EntryList = List<Entry>;
+
+        EntryList entries;                                ///< Entries, most recently used first
+        HashMap<Key, typename EntryList::iterator, Hash> index;///< Key to list node
+        size_t max_entries_;                              ///< Maximum number of entries
+        size_t max_bytes_;                                ///< Maximum total charge
+        size_t bytes_;                                    ///< Current total charge
+        size_t hits_;                                     ///< Lookups that found their key
+        size_t misses_;                                   ///< Lookups that did not
+        size_t evictions_;                                ///< Entries removed to respect the budget
+        eviction_callback on_evict;                       ///< Optional eviction callback
+
+        /**
+        * @brief Removes least recently used entries until the cache is within budget.
+        */
+        void enforce_budget() {
+            while (!entries.empty() && (entries.size() > max_entries_ || bytes_ > max_bytes_)) {
+                Entry &victim = entries.back();
+                ++evictions_;
+                if (on_evict)
+                    on_evict(victim.key, victim.value);
+                bytes_ -= victim.bytes;
+                index.erase(victim.key);
+                entries.pop_back();
+            }
+        }
+
+    public:
+        /**
+        * @brief Constructs a new LRUCache.
+        *
+        * @param max_entries Maximum number of entries; must be positive.
+        * @param max_bytes Maximum total charge of all entries (default is unlimited).
+        * @param hash Hash function object (default is Hash()).
+        * @throw std::invalid_argument if max_entries is 0.
+        */
+        explicit LRUCache(size_t max_entries, size_t max_bytes = std::numeric_limits<size_t>::max(),
+                          const Hash &hash = Hash())
+            : index(16, hash), max_entries_(max_entries), max_bytes_(max_bytes), bytes_(0), hits_(0), misses_(0),
+              evictions_(0) {
+            if (max_entries == 0)
+                throw std::invalid_argument("LRUCache capacity must be positive");
+        }
+
+        LRUCache(const LRUCache &) = delete;
+        LRUCache &operator=(const LRUCache &) = delete;
+
+        /**
+        * @brief Looks up a key and marks it as most recently used.
+        *
+        * @param key The key to search for.
+        * @return Value* The cached value, or nullptr on a miss. Valid until the
+        *         entry is evicted or erased.
+        *
+        * Time Complexity: O(1) on average.
+        */
+        Value *get(const Key &key) {
+            auto it = index.find(key);
+            if (it == index.end()) {
+                ++misses_;
+                return nullptr;
+            }
+            ++hits_;
+            auto node = it->second;
+            entries.splice(entries.begin(), entries, node);
+            return &node->value;
+        }
+
+        /**
+        * @brief Checks if a key is cached without changing its recency or the counters.
+        *
+        * @param key The key to search for.
+        * @return true If the key is cached.
+        */
+        bool contains(const Key &key) const { return index.contains(key); }
+
+        /**
+        * @brief Inserts or replaces an entry and marks it as most recently used.
+        *
+        * Evicts least recently used entries afterwards until both the entry
+        * count and the byte budget are respected. An entry charged more than the
+        * whole byte budget is therefore evicted immediately.
+        *
+        * @tparam V Type of the value, convertible and assignable to Value.
+        * @param key The key of the entry.
+        * @param value The value to cache.
+        * @param bytes Charge of the entry against the byte budget (default is 0).
+        *
+        * Time Complexity: O(1) on average, plus O(1) per evicted entry.
+        */
+        template<typename V>
+        void put(const Key &key, V &&value, size_t bytes = 0) {
+            auto [it, inserted] = index.try_emplace(key);
+            if (inserted) {
+                try {
+                    it->second = entries.emplace(entries.begin(), Entry{key, Value(std::forward<V>(value)), bytes});
+                } catch (...) {
+                    index.erase(it);
+                    throw;
+                }
+            } else {
+                auto node = it->second;
+                node->value = std::forward<V>(value);
+                bytes_ -= node->bytes;
+                node->bytes = bytes;
+                entries.splice(entries.begin(), entries, node);
+            }
+            bytes_ += bytes;
+            enforce_budget();
+        }
+
+        /**
+        * @brief Removes an entry without invoking the eviction callback.
+        *
+        * @param key The key of the entry to remove.
+        * @return true If the entry was cached.
+        *
+        * Time Complexity: O(1) on average.
+        */
+        bool erase(const Key &key) {
+            auto it = index.find(key);
+            if (it == index.end())
+                return false;
+            auto node = it->second;
+            bytes_ -= node->bytes;
+            index.erase(it);
+            entries.erase(node);
+            return true;
+        }
+
+        /**
+        * @brief Removes all entries without invoking the eviction callback.
+        */
+        void clear() {
+            index.clear();
+            entries.clear();
+            bytes_ = 0;
+        }
+
+        /**
+        * @brief Sets the function called with each entry evicted to respect the budget.
+        *
+        * The callback runs before the entry is destroyed and may move from the
+        * value; it must not access the cache.
+        *
+        * @param callback The callback, or an empty function to disable it.
+        */
+        void set_eviction_callback(eviction_callback callback) { on_evict = std::move(callback); }
+
+        /**
+        * @brief Changes the budget, evicting entries if the cache is now over it.
+        *
+        * @param max_entries Maximum number of entries; must be positive.
+        * @param max_bytes Maximum total charge (default is unlimited).
+        * @throw std::invalid_argument if max_entries is 0.
+        */
+        void resize(size_t max_entries, size_t max_bytes = std::numeric_limits<size_t>::max()) {
+            if (max_entries == 0)
+                throw std::invalid_argument("LRUCache capacity must be positive");
+            max_entries_ = max_entries;
+            max_bytes_ = max_bytes;
+            enforce_budget();
+        }
+
+        /**
+        * @brief Returns the number of cached entries.
+        */
+        size_t size() const { return entries.size(); }
+
+        /**
+        * @brief Checks if the cache is empty.
+        */
+        bool empty() const { return entries.empty(); }
+
+        /**
+        * @brief Returns the total charge of the cached entries.
+        */
+        size_t bytes() const { return bytes_; }
+
+        /**
+        * @brief Returns the maximum number of entries.
+        */
+        size_t capacity() const { return max_entries_; }
+
+        /**
+        * @brief Returns the byte budget.
+        */
+        size_t max_bytes() const { return max_bytes_; }
+
+        /**
+        * @brief Returns the number of get() calls that found their key.
+        */
+        size_t hits() const { return hits_; }
+
+        /**
+        * @brief Returns the number of get() calls that missed.
+        */
+        size_t misses() const { return misses_; }
+
+        /**
+        * @brief Returns the number of entries evicted to respect the budget.
+        */
+        size_t evictions() const { return evictions_; }
+
+        /**
+        * @brief Returns the fraction of get() calls that hit, or 0 before the first call.
+        */
+        double hit_rate() const {
+            size_t lookups = hits_ + misses_;
+            return lookups ? static_cast<double>(hits_) / static_cast<double>(lookups) : 0.0;
+        }
+    };
+
+}// namespace userDefineDataStructure
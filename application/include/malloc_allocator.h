@@ -0,0 +1,83 @@
+#pragma once
+
+#include "vector.h"
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <new>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#endif
+
+/**
+ * @class MallocAllocator
+ * @brief An allocator that takes memory from malloc and reports the full block malloc handed out.
+ *
+ * malloc rounds every request up to one of its size classes. allocate_at_least()
+ * asks malloc how large the block really is (malloc_usable_size on glibc,
+ * malloc_size on macOS), and vector takes that as its capacity, so no byte of
+ * the block is left unused. On other systems the requested size is reported.
+ *
+ * Usage example:
+ * @code
+ * userDefineDataStructure::vector<int, userDefineDataStructure::MallocAllocator<int>> ids;
+ * ids.push_back(1);// capacity() is every int that fits in malloc's smallest block
+ * @endcode
+ *
+ * @tparam T The type of elements to allocate; alignof(T) may not exceed alignof(std::max_align_t).
+ */
+
+namespace userDefineDataStructure {
+    template<typename T>
+    class MallocAllocator {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "MallocAllocator does not support over-aligned types");
+
+    public:
+        using value_type = T;
+
+        MallocAllocator() noexcept = default;
+
+        template<typename U>
+        MallocAllocator(const MallocAllocator<U> &) noexcept {}
+
+        /**
+         * @brief Allocates storage for n elements.
+         * @throw std::bad_alloc if the memory cannot be allocated.
+         */
+        T *allocate(size_t n) { return allocate_at_least(n).ptr; }
+
+        /**
+         * @brief Allocates storage for at least n elements.
+         * @param n The number of elements needed.
+         * @return The storage and the number of elements that fit in the block malloc returned.
+         * @throw std::bad_alloc if the memory cannot be allocated.
+         */
+        allocation_result<T *> allocate_at_least(size_t n) {
+            if (n > std::numeric_limits<size_t>::max() / sizeof(T))
+                throw std::bad_array_new_length();
+            void *memory = std::malloc(n * sizeof(T));
+            if (!memory)
+                throw std::bad_alloc();
+#if defined(__GLIBC__)
+            size_t usable = ::malloc_usable_size(memory);
+#elif defined(__APPLE__)
+            size_t usable = ::malloc_size(memory);
+#else
+            size_t usable = n * sizeof(T);
+#endif
+            return {static_cast<T *>(memory), usable / sizeof(T)};
+        }
+
+        /**
+         * @brief Frees storage obtained from allocate() or allocate_at_least().
+         */
+        void deallocate(T *p, size_t) noexcept { std::free(p); }
+
+        template<typename U>
+        bool operator==(const MallocAllocator<U> &) const noexcept { return true; }
+    };
+
+}// namespace userDefineDataStructure
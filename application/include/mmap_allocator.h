@@ -0,0 +1,162 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @class MmapAllocator
+ * @brief An allocator for very large vectors that grow in place with mremap().
+ *
+ * Buffers of at least kMmapThreshold bytes are mapped directly from the kernel
+ * and marked with MADV_HUGEPAGE. vector recognizes the reallocate() member and,
+ * for trivially relocatable elements, grows such a buffer by remapping its pages
+ * instead of allocating a second buffer and copying into it: no element is
+ * copied and the peak memory use stays at the size of the buffer itself.
+ * Smaller buffers come from operator new, so small vectors do not waste a page.
+ *
+ * Usage example:
+ * @code
+ * userDefineDataStructure::vector<double, userDefineDataStructure::MmapAllocator<double>> column;
+ * for (size_t i = 0; i < rows; ++i)
+ *     column.push_back(values[i]);
+ * @endcode
+ *
+ * @tparam T The type of elements to allocate.
+ *
+ * @note Mapping and remapping is Linux-specific; on other systems every buffer
+ *       comes from operator new and reallocate() copies.
+ */
+
+namespace userDefineDataStructure {
+    template<typename T>
+    class MmapAllocator {
+    public:
+        using value_type = T;
+
+        static constexpr size_t kMmapThreshold = 1 << 20;///< Buffers of this many bytes or more are mapped
+
+        MmapAllocator() noexcept = default;
+
+        template<typename U>
+        MmapAllocator(const MmapAllocator<U> &) noexcept {}
+
+        /**
+         * @brief Allocates uninitialized storage for n elements.
+         * @param n The number of elements.
+         * @return Pointer to the storage.
+         * @throw std::bad_alloc if the memory cannot be allocated.
+         */
+        T *allocate(size_t n) {
+            size_t bytes = byte_size(n);
+#if defined(__linux__)
+            if (mapped(bytes)) {
+                void *memory = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (memory == MAP_FAILED)
+                    throw std::bad_alloc();
+                advise(memory, bytes);
+                return static_cast<T *>(memory);
+            }
+#endif
+            return static_cast<T *>(::operator new(bytes, std::align_val_t(alignof(T))));
+        }
+
+        /**
+         * @brief Frees storage obtained from allocate() or reallocate().
+         * @param p Pointer to the storage.
+         * @param n The number of elements it was allocated for.
+         */
+        void deallocate(T *p, size_t n) noexcept {
+            size_t bytes = byte_size(n);
+#if defined(__linux__)
+            if (mapped(bytes)) {
+                ::munmap(p, bytes);
+                return;
+            }
+#endif
+            ::operator delete(p, std::align_val_t(alignof(T)));
+        }
+
+        /**
+         * @brief Resizes storage, keeping its first min(old_n, new_n) elements' bytes.
+         *
+         * Mapped buffers are resized with mremap(), which moves page table entries
+         * rather than data. The contents are moved bytewise, so this is only valid
+         * for trivially relocatable elements.
+         *
+         * @param p Pointer to the storage.
+         * @param old_n The number of elements it was allocated for.
+         * @param new_n The number of elements to allocate for.
+         * @return T* Pointer to the resized storage; p is invalid afterwards.
+         * @throw std::bad_alloc if the memory cannot be allocated; p is then unchanged.
+         */
+        T *reallocate(T *p, size_t old_n, size_t new_n) {
+            size_t old_bytes = byte_size(old_n);
+            size_t new_bytes = byte_size(new_n);
+#if defined(__linux__)
+            if (mapped(old_bytes) && mapped(new_bytes)) {
+                void *memory = ::mremap(p, old_bytes, new_bytes, MREMAP_MAYMOVE);
+                if (memory == MAP_FAILED)
+                    throw std::bad_alloc();
+                advise(memory, new_bytes);
+                return static_cast<T *>(memory);
+            }
+#endif
+            T *result = allocate(new_n);
+            std::memcpy(static_cast<void *>(result), p, std::min(old_n, new_n) * sizeof(T));
+            deallocate(p, old_n);
+            return result;
+        }
+
+        template<typename U>
+        bool operator==(const MmapAllocator<U> &) const noexcept { return true; }
+
+    private:
+        /**
+         * @brief Returns the bytes held for n elements, rounded up to whole pages when mapped.
+         */
+        static size_t byte_size(size_t n) {
+            if (n > std::numeric_limits<size_t>::max() / sizeof(T))
+                throw std::bad_array_new_length();
+            size_t bytes = n * sizeof(T);
+            if (!mapped(bytes))
+                return bytes;
+            size_t page = page_size();
+            return (bytes + page - 1) & ~(page - 1);
+        }
+
+        static bool mapped(size_t bytes) {
+#if defined(__linux__)
+            return bytes >= kMmapThreshold;
+#else
+            return false;
+#endif
+        }
+
+#if defined(__linux__)
+        static size_t page_size() {
+            static const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+            return page;
+        }
+
+        /**
+         * @brief Asks for transparent huge pages; a hint only, so failure is ignored.
+         */
+        static void advise(void *memory, size_t bytes) {
+#if defined(MADV_HUGEPAGE)
+            ::madvise(memory, bytes, MADV_HUGEPAGE);
+#endif
+        }
+#else
+        static size_t page_size() { return 1; }
+#endif
+    };
+
+}// namespace userDefineDataStructure
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @class NodePool
+ * @brief A slab allocator for fixed-size nodes, such as the nodes of a List.
+ *
+ * Nodes are carved out of 64 KiB slabs with a bump pointer and recycled through
+ * an intrusive free list, so allocating a node costs a few instructions and no
+ * per-node allocator header. Slabs are aligned to their size and start with a
+ * pointer to their pool, so a node can be returned without knowing which pool
+ * it came from; this keeps the deleter of a List node stateless. All slabs are
+ * freed together by release() or when the pool is destroyed.
+ *
+ * Usage example:
+ * @code
+ * struct PooledPolicy : userDefineDataStructure::HashMapPolicy {
+ *     using node_allocator = userDefineDataStructure::PoolNodeAllocator;
+ * };
+ * userDefineDataStructure::HashMap<uint64_t, uint64_t, std::hash<uint64_t>, PooledPolicy> map;
+ * @endcode
+ *
+ * @warning This class is not thread-safe; every node of a pool must be allocated
+ *          and returned under the same external synchronization.
+ */
+
+namespace userDefineDataStructure {
+    class NodePool {
+    public:
+        static constexpr size_t kSlabSize = 64 * 1024;///< Size and alignment of every slab
+
+    private:
+        /**
+        * @brief Bookkeeping at the start of each slab.
+        */
+        struct SlabHeader {
+            NodePool *pool; ///< Owner, found from any node address by masking
+            SlabHeader *next;///< Next slab of the same pool
+        };
+
+        /**
+        * @brief A returned node, reused as a free list link.
+        */
+        struct FreeNode {
+            FreeNode *next;
+        };
+
+        SlabHeader *slabs;  ///< All slabs, most recent first
+        FreeNode *free_list;///< Returned nodes, ready for reuse
+        char *bump;         ///< Next never-used byte of the newest slab
+        char *bump_end;     ///< End of the newest slab
+        size_t node_size;   ///< Size of every node, fixed by the first allocation
+        size_t slab_count;  ///< Number of slabs held
+        size_t live;        ///< Nodes allocated and not yet returned
+
+        /**
+        * @brief Frees every slab.
+        */
+        void free_slabs() {
+            while (slabs) {
+                SlabHeader *next = slabs->next;
+                ::operator delete(slabs, std::align_val_t(kSlabSize));
+                slabs = next;
+            }
+            free_list = nullptr;
+            bump = bump_end = nullptr;
+            slab_count = 0;
+        }
+
+        /**
+        * @brief Allocates a new slab and makes it the bump region.
+        */
+        void add_slab(size_t alignment) {
+            auto *slab = static_cast<SlabHeader *>(::operator new(kSlabSize, std::align_val_t(kSlabSize)));
+            slab->pool = this;
+            slab->next = slabs;
+            slabs = slab;
+            ++slab_count;
+            uintptr_t first = reinterpret_cast<uintptr_t>(slab + 1);
+            first = (first + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+            bump = reinterpret_cast<char *>(first);
+            bump_end = reinterpret_cast<char *>(slab) + kSlabSize;
+        }
+
+    public:
+        /**
+        * @brief Constructs an empty pool; no memory is allocated until the first node.
+        */
+        NodePool()
+            : slabs(nullptr), free_list(nullptr), bump(nullptr), bump_end(nullptr), node_size(0), slab_count(0), live(0) {}
+
+        NodePool(const NodePool &) = delete;
+        NodePool &operator=(const NodePool &) = delete;
+
+        /**
+        * @brief Frees every slab; all nodes must have been returned.
+        */
+        ~NodePool() { free_slabs(); }
+
+        /**
+        * @brief Allocates uninitialized memory for one node.
+        *
+        * @param size Size of the node; every allocation from a pool must use the same size.
+        * @param alignment Alignment of the node; at most alignof(std::max_align_t).
+        * @return void* Memory for the node.
+        * @throw std::invalid_argument if size differs from earlier allocations.
+        * @throw std::length_error if a node does not fit in a slab.
+        * @throw std::bad_alloc if a new slab cannot be allocated.
+        *
+        * Time Complexity: O(1)
+        */
+        void *allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+            size = (std::max(size, sizeof(FreeNode)) + alignment - 1) & ~(alignment - 1);
+            if (node_size == 0) {
+                if (size > kSlabSize - sizeof(SlabHeader) - alignment)
+                    throw std::length_error("NodePool: node larger than a slab");
+                node_size = size;
+            } else if (size != node_size) {
+                throw std::invalid_argument("NodePool: all nodes of a pool must have the same size");
+            }
+
+            void *node;
+            if (free_list) {
+                node = free_list;
+                free_list = free_list->next;
+            } else {
+                if (static_cast<size_t>(bump_end - bump) < node_size)
+                    add_slab(alignment);
+                node = bump;
+                bump += node_size;
+            }
+            ++live;
+            return node;
+        }
+
+        /**
+        * @brief Returns a node to the pool it was allocated from.
+        *
+        * @param node Memory obtained from allocate() of any pool.
+        *
+        * Time Complexity: O(1)
+        */
+        static void deallocate(void *node) {
+            auto *slab = reinterpret_cast<SlabHeader *>(reinterpret_cast<uintptr_t>(node) & ~(static_cast<uintptr_t>(kSlabSize) - 1));
+            NodePool *pool = slab->pool;
+            auto *free = static_cast<FreeNode *>(node);
+            free->next = pool->free_list;
+            pool->free_list = free;
+            --pool->live;
+        }
+
+        /**
+        * @brief Frees all slabs at once if no node is in use.
+        *
+        * @return true If the memory was released.
+        */
+        bool release() {
+            if (live != 0)
+                return false;
+            free_slabs();
+            return true;
+        }
+
+        /**
+        * @brief Returns the number of nodes in use.
+        */
+        size_t live_nodes() const { return live; }
+
+        /**
+        * @brief Returns the number of bytes held in slabs.
+        */
+        size_t bytes_reserved() const { return slab_count * kSlabSize; }
+    };
+
+    /**
+    * @brief List node allocator that takes nodes from a shared NodePool.
+    *
+    * All lists that splice nodes between each other, such as the buckets of
+    * one HashMap, must use the same pool. Select it for a HashMap through
+    * HashMapPolicy::node_allocator; the map then owns the pool.
+    */
+    struct PoolNodeAllocator {
+        using pool_type = NodePool;///< Resource a HashMap creates and owns for this allocator
+
+        NodePool *pool;///< The pool nodes are taken from
+
+        explicit PoolNodeAllocator(NodePool *p) : pool(p) {}
+
+        /**
+        * @brief Constructs a node in memory from the pool.
+        */
+        template<typename Node, typename... Args>
+        Node *create(Args &&...args) {
+            void *memory = pool->allocate(sizeof(Node), alignof(Node));
+            try {
+                return new (memory) Node(std::forward<Args>(args)...);
+            } catch (...) {
+                NodePool::deallocate(memory);
+                throw;
+            }
+        }
+
+        /**
+        * @brief Destroys a node and returns its memory to its pool.
+        */
+        template<typename Node>
+        static void destroy(Node *node) {
+            node->~Node();
+            NodePool::deallocate(node);
+        }
+
+        bool operator==(const PoolNodeAllocator &) const = default;
+    };
+
+}// namespace userDefineDataStructure
@@ -1,3 +1,5 @@
+#pragma once
+
 #include <functional>
 #include <iterator>
 #include <memory>
@@ -690,16 +692,22 @@ namespace userDefineDataStructure {
         * Time Complexity: O(log n), where n is the number of elements in the set.
         */
         iterator find(const Key &value) const {
-            Node *current = root;
-            while (current && current != end_node) {
-                if (comp(value, current->value))
-                    current = current->left;
-                else if (comp(current->value, value))
-                    current = current->right;
-                else
-                    return iterator(current, this);// Found
-            }
-            return end();// Not found
+            return iterator(findNode(value), this);
+        }
+
+        /**
+        * @brief Finds an element comparing equivalent to a value of another type.
+        * @tparam K Type of the value; only available when Compare::is_transparent exists.
+        * @param value The value to search for.
+        * @return Iterator to an element equivalent to value, or end() if there is none.
+        *
+        * Lets a set of handles be searched by the key they refer to without
+        * building a handle first.
+        * Time Complexity: O(log n), where n is the number of elements in the set.
+        */
+        template<class K, class C = Compare, class = typename C::is_transparent>
+        iterator find(const K &value) const {
+            return iterator(findNode(value), this);
         }
 
         /**
@@ -727,6 +735,7 @@ namespace userDefineDataStructure {
 
             Node *y = nodeToDelete;
             Node *x = nullptr;
+            Node *xParent = nodeToDelete->parent;// x may be null, so track where it hangs
             Color originalColor = y->color;
 
             if (!nodeToDelete->left) {
@@ -740,8 +749,10 @@ namespace userDefineDataStructure {
                 originalColor = y->color;
                 x = y->right;
                 if (y->parent == nodeToDelete) {
+                    xParent = y;
                     if (x) x->parent = y;
                 } else {
+                    xParent = y->parent;
                     transplant(y, y->right);
                     y->right = nodeToDelete->right;
                     if (y->right) y->right->parent = y;
@@ -752,7 +763,6 @@ namespace userDefineDataStructure {
                 y->color = nodeToDelete->color;
             }
 
-            Node *xParent = x ? x->parent : (y->parent == nodeToDelete ? y : y->parent);
             NodeAllocTraits::destroy(node_alloc, nodeToDelete);
             NodeAllocTraits::deallocate(node_alloc, nodeToDelete, 1);
 
@@ -810,6 +820,27 @@ namespace userDefineDataStructure {
         }
 
     private:
+        /**
+        * @brief Locates the node holding a value equivalent to the given one.
+        * @param value The value to search for.
+        * @return The matching node, or end_node if there is none.
+        *
+        * Time Complexity: O(log n), where n is the number of elements in the set.
+        */
+        template<class K>
+        Node *findNode(const K &value) const {
+            Node *current = root;
+            while (current && current != end_node) {
+                if (comp(value, current->value))
+                    current = current->left;
+                else if (comp(current->value, value))
+                    current = current->right;
+                else
+                    return current;// Found
+            }
+            return end_node;// Not found
+        }
+
         /**
         * @brief Replaces one subtree as a child of its parent with another subtree.
         * @param u The node to be replaced.
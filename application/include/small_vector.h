@@ -0,0 +1,312 @@
+#pragma once
+
+#include "vector.h"
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+/**
+ * @class small_vector
+ * @brief A vector that stores up to N elements inline and only allocates beyond that.
+ *
+ * small_vector is a vector whose storage starts out in a buffer inside the
+ * object itself, so building, filling and destroying a vector of at most N
+ * elements never touches the heap. The N+1st element spills everything to a
+ * heap buffer obtained from Allocator and grown by GrowthPolicy, exactly as a
+ * vector would; the inline buffer is not used again until the vector is moved
+ * from. All other operations are those of vector.
+ *
+ * @tparam T The type of elements.
+ * @tparam N The number of elements stored inline.
+ * @tparam Allocator The allocator for spilled storage, defaults to std::allocator<T>.
+ * @tparam GrowthPolicy How spilled storage grows, defaults to HalfGrowthPolicy.
+ *
+ * Usage example:
+ * @code
+ * userDefineDataStructure::small_vector<int, 8> ids;
+ * for (int id : request.ids())
+ *     ids.push_back(id);// no allocation for up to 8 ids
+ * @endcode
+ *
+ * @note Moving a small_vector whose elements are inline moves them one by one,
+ *       and swap() then costs O(N); a spilled small_vector moves in O(1).
+ */
+
+namespace userDefineDataStructure {
+    namespace detail {
+        /**
+        * @brief Uninitialized storage for N elements, a base so that it is constructed before the vector.
+        */
+        template<typename T, size_t N>
+        struct InlineBuffer {
+            alignas(T) unsigned char bytes[N * sizeof(T)];
+
+            T *inline_data() noexcept { return reinterpret_cast<T *>(bytes); }
+            const T *inline_data() const noexcept { return reinterpret_cast<const T *>(bytes); }
+        };
+
+        /**
+        * @brief Allocator of a small_vector: forwards to Allocator, but never frees the inline buffer.
+        *
+        * construct(), destroy() and allocate_at_least() exist exactly when Allocator
+        * has them, so vector sees the same allocator capabilities as for Allocator
+        * itself. The vector only allocates to grow past its capacity, which never drops
+        * below N, so allocate() always goes to the upstream allocator.
+        */
+        template<typename T, typename Allocator>
+        struct InlineBufferAllocator {
+            using value_type = T;
+
+            Allocator upstream;///< Allocator for spilled storage
+            T *buffer;         ///< Inline buffer of the owning small_vector
+
+            InlineBufferAllocator(const Allocator &alloc, T *inline_buffer) : upstream(alloc), buffer(inline_buffer) {}
+
+            T *allocate(size_t n) { return std::allocator_traits<Allocator>::allocate(upstream, n); }
+
+            auto allocate_at_least(size_t n)
+                requires requires(Allocator &a, size_t m) { a.allocate_at_least(m); }
+            {
+                return upstream.allocate_at_least(n);
+            }
+
+            void deallocate(T *p, size_t n) {
+                if (p != buffer)
+                    std::allocator_traits<Allocator>::deallocate(upstream, p, n);
+            }
+
+            /**
+            * @brief Forwards element construction, present only if Allocator customizes it.
+            */
+            template<typename U, typename... Args>
+                requires requires(Allocator &a, U *p, Args &&...args) { a.construct(p, std::forward<Args>(args)...); }
+            void construct(U *p, Args &&...args) {
+                std::allocator_traits<Allocator>::construct(upstream, p, std::forward<Args>(args)...);
+            }
+
+            /**
+            * @brief Forwards element destruction, present only if Allocator customizes it.
+            */
+            template<typename U>
+                requires requires(Allocator &a, U *p) { a.destroy(p); }
+            void destroy(U *p) {
+                std::allocator_traits<Allocator>::destroy(upstream, p);
+            }
+
+            bool operator==(const InlineBufferAllocator &) const = default;
+        };
+    }// namespace detail
+
+    template<typename T, size_t N, typename Allocator = std::allocator<T>, typename GrowthPolicy = HalfGrowthPolicy>
+    class small_vector : private detail::InlineBuffer<T, N>,
+                         private vector<T, detail::InlineBufferAllocator<T, Allocator>, GrowthPolicy> {
+        static_assert(N > 0, "small_vector needs room for at least one inline element");
+
+        using Buffer = detail::InlineBuffer<T, N>;
+        using Base = vector<T, detail::InlineBufferAllocator<T, Allocator>, GrowthPolicy>;
+
+    public:
+        using typename Base::const_iterator;
+        using typename Base::const_pointer;
+        using typename Base::const_reference;
+        using typename Base::difference_type;
+        using typename Base::iterator;
+        using typename Base::pointer;
+        using typename Base::reference;
+        using typename Base::size_type;
+        using typename Base::value_type;
+        using allocator_type = Allocator;///< The allocator type for spilled storage.
+
+        static constexpr size_type inline_capacity = N;///< Elements stored without allocating
+
+        /**
+         * @brief Constructs an empty small_vector with room for N elements inline.
+         */
+        small_vector() noexcept(noexcept(Allocator()))
+            : small_vector(Allocator()) {}
+
+        /**
+         * @brief Constructs an empty small_vector with room for N elements inline.
+         * @param alloc Allocator to use once the elements spill to the heap.
+         */
+        explicit small_vector(const Allocator &alloc) noexcept
+            : Base(detail::InlineBufferAllocator<T, Allocator>(alloc, this->inline_data())) {
+            reset_to_inline();
+        }
+
+        /**
+         * @brief Constructs a small_vector with count copies of value.
+         */
+        small_vector(size_type count, const T &value, const Allocator &alloc = Allocator())
+            : small_vector(alloc) {
+            assign(count, value);
+        }
+
+        /**
+         * @brief Constructs a small_vector with count value-initialized elements.
+         */
+        explicit small_vector(size_type count, const Allocator &alloc = Allocator())
+            : small_vector(alloc) {
+            resize(count);
+        }
+
+        /**
+         * @brief Constructs a small_vector with the elements of the range [first, last).
+         */
+        template<std::input_iterator InputIt>
+        small_vector(InputIt first, InputIt last, const Allocator &alloc = Allocator())
+            : small_vector(alloc) {
+            assign(first, last);
+        }
+
+        /**
+         * @brief Constructs a small_vector with the elements of an initializer list.
+         */
+        small_vector(std::initializer_list<T> init, const Allocator &alloc = Allocator())
+            : small_vector(alloc) {
+            assign(init.begin(), init.end());
+        }
+
+        /**
+         * @brief Copy constructor; the copy is inline if the elements fit.
+         */
+        small_vector(const small_vector &other)
+            : small_vector(other.alloc_.upstream) {
+            assign(other.begin(), other.end());
+        }
+
+        /**
+         * @brief Move constructor; takes over spilled storage, or moves inline elements one by one.
+         * The moved-from small_vector is left empty and inline.
+         */
+        small_vector(small_vector &&other) noexcept(std::is_nothrow_move_constructible_v<T>)
+            : small_vector(other.alloc_.upstream) {
+            take(other);
+        }
+
+        /**
+         * @brief Destroys the elements and frees spilled storage, if any.
+         */
+        ~small_vector() = default;
+
+        /**
+         * @brief Copy assignment operator.
+         */
+        small_vector &operator=(const small_vector &other) {
+            if (this != &other)
+                assign(other.begin(), other.end());
+            return *this;
+        }
+
+        /**
+         * @brief Move assignment operator; the moved-from small_vector is left empty and inline.
+         */
+        small_vector &operator=(small_vector &&other) noexcept(std::is_nothrow_move_constructible_v<T> &&
+                                                               std::is_nothrow_move_assignable_v<T>) {
+            if (this != &other) {
+                if (!other.is_inline()) {
+                    clear();
+                    this->deallocate();
+                    reset_to_inline();
+                }
+                take(other);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Replaces the contents with the elements of an initializer list.
+         */
+        small_vector &operator=(std::initializer_list<T> ilist) {
+            assign(ilist.begin(), ilist.end());
+            return *this;
+        }
+
+        using Base::append_range;
+        using Base::assign;
+        using Base::at;
+        using Base::back;
+        using Base::begin;
+        using Base::capacity;
+        using Base::cbegin;
+        using Base::cend;
+        using Base::clear;
+        using Base::data;
+        using Base::emplace_back;
+        using Base::empty;
+        using Base::end;
+        using Base::erase;
+        using Base::front;
+        using Base::insert;
+        using Base::operator[];
+        using Base::pop_back;
+        using Base::push_back;
+        using Base::reserve;
+        using Base::resize;
+        using Base::size;
+
+        /**
+         * @brief Returns true while the elements are stored in the inline buffer.
+         */
+        bool is_inline() const noexcept { return this->begin_ == this->inline_data(); }
+
+        /**
+         * @brief Returns a copy of the allocator for spilled storage.
+         */
+        allocator_type get_allocator() const { return this->alloc_.upstream; }
+
+        /**
+         * @brief Swaps the contents of two small_vectors.
+         * O(1) if both have spilled; otherwise the inline elements are moved.
+         */
+        void swap(small_vector &other) {
+            if (!is_inline() && !other.is_inline()) {
+                std::swap(this->begin_, other.begin_);
+                std::swap(this->end_, other.end_);
+                std::swap(this->cap_, other.cap_);
+                std::swap(this->alloc_.upstream, other.alloc_.upstream);
+                return;
+            }
+            small_vector tmp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(tmp);
+        }
+
+    private:
+        /**
+         * @brief Points the vector at the empty inline buffer; any previous storage must have been released.
+         */
+        void reset_to_inline() noexcept {
+            this->begin_ = this->end_ = this->inline_data();
+            this->cap_ = this->begin_ + N;
+        }
+
+        /**
+         * @brief Takes the elements of other, which is left empty and inline.
+         * If other has spilled, this must be inline, and takes over the spilled storage.
+         */
+        void take(small_vector &other) {
+            if (other.is_inline()) {
+                assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+                other.clear();
+            } else {
+                clear();
+                this->begin_ = other.begin_;
+                this->end_ = other.end_;
+                this->cap_ = other.cap_;
+                this->alloc_.upstream = other.alloc_.upstream;
+                other.reset_to_inline();
+            }
+        }
+    };
+
+    /**
+    * @brief Swaps the contents of two small_vectors.
+    */
+    template<typename T, size_t N, typename Allocator, typename GrowthPolicy>
+    void swap(small_vector<T, N, Allocator, GrowthPolicy> &a, small_vector<T, N, Allocator, GrowthPolicy> &b) {
+        a.swap(b);
+    }
+
+}// namespace userDefineDataStructure
@@ -2,9 +2,16 @@
 #pragma once
 
 #include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
 #include <limits>
 #include <memory>
+#include <ranges>
 #include <stdexcept>
+#include <type_traits>
 
 
 /**
@@ -20,8 +27,138 @@
  * It maintains elements in sorted order and does not allow duplicate keys.
  */
 namespace userDefineDataStructure {
-    template<typename T, typename Allocator = std::allocator<T>>
+    /**
+     * @brief Whether moving a T to a new address and destroying the original is equivalent to copying its bytes.
+     *
+     * True for trivially copyable types. Specialize it as std::true_type for types
+     * that hold no pointers into themselves, such as wrappers of std::unique_ptr or
+     * std::vector, so that vector grows them with memcpy:
+     * @code
+     * template<>
+     * struct userDefineDataStructure::is_trivially_relocatable<Handle> : std::true_type {};
+     * @endcode
+     */
+    template<typename T>
+    struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+    template<typename T>
+    inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+    /**
+    * @brief Growth that doubles the capacity.
+    *
+    * Fewest reallocations, but up to half of the capacity is unused, and a
+    * freed buffer is never large enough to be reused by the next growth step.
+    */
+    struct DoublingGrowthPolicy {
+        /**
+        * @brief Returns the capacity to grow to; the vector clamps it to [required, max_size()].
+        * @param current The current capacity.
+        * @param required The capacity needed at least.
+        * @param element_size sizeof(T).
+        */
+        static size_t capacity(size_t current, size_t required, size_t) {
+            return std::max(current > SIZE_MAX / 2 ? SIZE_MAX : 2 * current, required);
+        }
+    };
+
+    /**
+    * @brief Growth by a factor of 1.5.
+    *
+    * At most a third of the capacity is unused, and after a few steps the
+    * blocks freed earlier add up to the next request, so an allocator can
+    * coalesce and reuse them.
+    */
+    struct HalfGrowthPolicy {
+        static size_t capacity(size_t current, size_t required, size_t) {
+            return std::max(current > SIZE_MAX / 3 * 2 ? SIZE_MAX : current + current / 2, required);
+        }
+    };
+
+    /**
+    * @brief Growth by a fixed number of elements, rounded to a multiple of that number.
+    *
+    * At most Count elements are unused, at the price of a reallocation every
+    * Count insertions; suits vectors whose final size is roughly known.
+    *
+    * @tparam Count Elements added per growth step.
+    */
+    template<size_t Count>
+        requires(Count > 0)
+    struct ChunkGrowthPolicy {
+        static size_t capacity(size_t current, size_t required, size_t) {
+            size_t target = std::max(current > SIZE_MAX - Count ? SIZE_MAX : current + Count, required);
+            return target > SIZE_MAX - Count ? target : (target + Count - 1) / Count * Count;
+        }
+    };
+
+    /**
+    * @brief Doubling growth with the buffer rounded up to whole 4 KiB pages.
+    *
+    * Suits large vectors, whose buffers the allocator maps page by page anyway.
+    */
+    struct PageGrowthPolicy {
+        static constexpr size_t kPageSize = 4096;///< Bytes per page
+
+        static size_t capacity(size_t current, size_t required, size_t element_size) {
+            size_t target = DoublingGrowthPolicy::capacity(current, required, element_size);
+            if (target > (SIZE_MAX - kPageSize) / element_size)
+                return target;
+            size_t bytes = (target * element_size + kPageSize - 1) & ~(kPageSize - 1);
+            return bytes / element_size;
+        }
+    };
+
+    /**
+    * @brief Growth by 1.5x with the buffer rounded up to a coarse size-class grid.
+    *
+    * The grid has multiples of 16 bytes up to 128, then four classes per power
+    * of two, and whole pages from 16 KiB. It is not the class table of any
+    * particular malloc; it suits allocators with similarly coarse classes, where
+    * asking for the rounded size costs nothing. With glibc, which rounds to 16
+    * bytes, it only adds unused capacity. To use exactly the bytes an allocator
+    * hands out, give the vector an allocator with allocate_at_least(), such as
+    * MallocAllocator.
+    */
+    struct SizeClassGrowthPolicy {
+        /**
+        * @brief Returns the size class that serves a request of the given number of bytes.
+        */
+        static constexpr size_t size_class(size_t bytes) {
+            if (bytes <= 128)
+                return bytes <= 16 ? 16 : (bytes + 15) & ~size_t(15);
+            size_t spacing = std::min<size_t>(std::bit_floor(bytes - 1) / 4, 4096);
+            return bytes > SIZE_MAX - spacing ? bytes : (bytes + spacing - 1) & ~(spacing - 1);
+        }
+
+        static size_t capacity(size_t current, size_t required, size_t element_size) {
+            size_t target = HalfGrowthPolicy::capacity(current, required, element_size);
+            if (target > SIZE_MAX / 2 / element_size)
+                return target;
+            return size_class(target * element_size) / element_size;
+        }
+    };
+
+    /**
+    * @brief Result of an allocator's allocate_at_least(): the storage and the number of elements it holds.
+    *
+    * Mirrors C++23 std::allocation_result. vector uses allocate_at_least() when
+    * the allocator provides it, and takes the returned count as its capacity.
+    */
+    template<typename Pointer>
+    struct allocation_result {
+        Pointer ptr;
+        size_t count;
+    };
+
+    template<typename T, size_t N, typename Allocator, typename GrowthPolicy>
+    class small_vector;
+
+    template<typename T, typename Allocator = std::allocator<T>, typename GrowthPolicy = HalfGrowthPolicy>
     class vector {
+        template<typename, size_t, typename, typename>
+        friend class small_vector;///< Points begin_ at its inline buffer
+
     public:
         using value_type = T;                                                          ///< The type of elements.
         using allocator_type = Allocator;                                              ///< The allocator type.
@@ -69,6 +206,20 @@ namespace userDefineDataStructure {
             resize(count);
         }
 
+        /**
+         * @brief Constructs a vector with the elements of the range [first, last).
+         * Forward ranges are counted first and stored with a single allocation.
+         * @tparam InputIt Input iterator type.
+         * @param first Iterator to the first element in the range.
+         * @param last Iterator to the last element in the range.
+         * @param alloc Allocator to use for memory management.
+         */
+        template<std::input_iterator InputIt>
+        vector(InputIt first, InputIt last, const Allocator &alloc = Allocator())
+            : alloc_(alloc) {
+            assign(first, last);
+        }
+
         /**
          * @brief Copy constructor.
          * @param other The vector to copy from.
@@ -158,24 +309,48 @@ namespace userDefineDataStructure {
             clear();
             if (count > capacity()) {
                 deallocate();
-                begin_ = allocate(count);
-                cap_ = begin_ + count;
+                begin_ = end_ = cap_ = nullptr;
+                size_type new_cap = count;
+                begin_ = end_ = allocate(new_cap);
+                cap_ = begin_ + new_cap;
             }
-            end_ = begin_ + count;
-            std::fill_n(begin_, count, value);
+            end_ = fill_construct(begin_, count, value);
         }
 
         /**
          * @brief Assigns elements from a range [first, last) to the vector.
+         * Forward ranges are counted first: existing elements are assigned over and
+         * the vector reallocates at most once, to the size of the range.
          * @tparam InputIt Input iterator type.
          * @param first Iterator to the first element in the range.
          * @param last Iterator to the last element in the range.
          */
-        template<typename InputIt>
+        template<std::input_iterator InputIt>
         void assign(InputIt first, InputIt last) {
-            clear();
-            for (; first != last; ++first)
-                push_back(*first);
+            if constexpr (std::forward_iterator<InputIt>) {
+                auto count = static_cast<size_type>(std::distance(first, last));
+                if (count > capacity()) {
+                    clear();
+                    deallocate();
+                    begin_ = end_ = cap_ = nullptr;
+                    size_type new_cap = count;
+                    begin_ = end_ = allocate(new_cap);
+                    cap_ = begin_ + new_cap;
+                    end_ = copy_construct(first, count, begin_);
+                } else if (count > size()) {
+                    InputIt middle = std::next(first, size());
+                    std::copy(first, middle, begin_);
+                    end_ = copy_construct(middle, count - size(), end_);
+                } else {
+                    pointer new_end = std::copy(first, last, begin_);
+                    destroy_range(new_end, end_);
+                    end_ = new_end;
+                }
+            } else {
+                clear();
+                for (; first != last; ++first)
+                    emplace_back(*first);
+            }
         }
 
         /**
@@ -330,22 +505,104 @@ namespace userDefineDataStructure {
          * @brief Appends the given value to the end of the vector.
          * @param value The value to append.
          */
-        void push_back(const T &value) {
-            if (end_ == cap_)
-                reallocate(recommend(size() + 1));
-            std::allocator_traits<Allocator>::construct(alloc_, end_, value);
-            ++end_;
-        }
+        void push_back(const T &value) { emplace_back(value); }
 
         /**
          * @brief Appends the given value to the end of the vector.
          * @param value The value to append.
          */
-        void push_back(T &&value) {
-            if (end_ == cap_)
+        void push_back(T &&value) { emplace_back(std::move(value)); }
+
+        /**
+         * @brief Constructs an element in place at the end of the vector.
+         * The arguments may refer to elements of the vector itself.
+         * @tparam Args Types of the constructor arguments.
+         * @param args Arguments forwarded to the constructor of T.
+         * @return Reference to the new element.
+         */
+        template<typename... Args>
+        reference emplace_back(Args &&...args) {
+            if (end_ != cap_) {
+                std::allocator_traits<Allocator>::construct(alloc_, end_, std::forward<Args>(args)...);
+            } else {
+                // Build the element before reallocating, in case args point into the old storage.
+                T value(std::forward<Args>(args)...);
                 reallocate(recommend(size() + 1));
-            std::allocator_traits<Allocator>::construct(alloc_, end_, std::move(value));
-            ++end_;
+                std::allocator_traits<Allocator>::construct(alloc_, end_, std::move(value));
+            }
+            return *end_++;
+        }
+
+        /**
+         * @brief Inserts the elements of the range [first, last) before pos.
+         * Forward ranges are counted first, so the vector reallocates at most once.
+         * @tparam InputIt Input iterator type; must not point into this vector.
+         * @param pos Iterator before which the elements are inserted.
+         * @param first Iterator to the first element in the range.
+         * @param last Iterator to the last element in the range.
+         * @return Iterator to the first inserted element, or pos if the range is empty.
+         */
+        template<std::input_iterator InputIt>
+        iterator insert(const_iterator pos, InputIt first, InputIt last) {
+            auto offset = static_cast<size_type>(pos - begin_);
+            if constexpr (std::forward_iterator<InputIt>) {
+                auto count = static_cast<size_type>(std::distance(first, last));
+                if (count == 0)
+                    return begin_ + offset;
+                if (count > static_cast<size_type>(cap_ - end_))
+                    insert_reallocate(offset, first, count);
+                else
+                    insert_in_place(begin_ + offset, first, count);
+            } else {
+                size_type old_size = size();
+                for (; first != last; ++first)
+                    emplace_back(*first);
+                std::rotate(begin_ + offset, begin_ + old_size, end_);
+            }
+            return begin_ + offset;
+        }
+
+        /**
+         * @brief Appends the elements of a range to the end of the vector.
+         * Sized and forward ranges grow the vector at most once.
+         * @tparam R Input range type.
+         * @param range The range to append; must not refer to this vector.
+         */
+        template<std::ranges::input_range R>
+        void append_range(R &&range) {
+            if constexpr (std::ranges::forward_range<R> || std::ranges::sized_range<R>) {
+                auto count = static_cast<size_type>(std::ranges::distance(range));
+                if (count > static_cast<size_type>(cap_ - end_))
+                    reallocate(recommend(size() + count));
+                end_ = copy_construct(std::ranges::begin(range), count, end_);
+            } else {
+                for (auto &&value: range)
+                    emplace_back(std::forward<decltype(value)>(value));
+            }
+        }
+
+        /**
+         * @brief Removes the element at pos.
+         * @param pos Iterator to the element to remove.
+         * @return Iterator to the element following the removed one.
+         */
+        iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+        /**
+         * @brief Removes the elements in the range [first, last).
+         * The following elements are moved down once, whatever the length of the range.
+         * @param first Iterator to the first element to remove.
+         * @param last Iterator to the element past the last one to remove.
+         * @return Iterator to the element that followed the removed range.
+         */
+        iterator erase(const_iterator first, const_iterator last) {
+            pointer from = begin_ + (first - begin_);
+            if (first != last) {
+                pointer new_end = std::move(begin_ + (last - begin_), end_, from);
+                destroy_range(new_end, end_);
+                end_ = new_end;
+            }
+            return from;
         }
 
         /**
@@ -367,7 +624,7 @@ namespace userDefineDataStructure {
             if (count > size()) {
                 if (count > capacity())
                     reallocate(recommend(count));
-                std::uninitialized_value_construct(end_, begin_ + count);
+                fill_construct(end_, count - size());
             } else if (count < size())
                 destroy_range(begin_ + count, end_);
             end_ = begin_ + count;
@@ -384,7 +641,7 @@ namespace userDefineDataStructure {
             if (count > size()) {
                 if (count > capacity())
                     reallocate(recommend(count));
-                std::uninitialized_fill(end_, begin_ + count, value);
+                fill_construct(end_, count - size(), value);
             } else if (count < size())
                 destroy_range(begin_ + count, end_);
             end_ = begin_ + count;
@@ -407,14 +664,38 @@ namespace userDefineDataStructure {
         pointer cap_ = nullptr;                ///< Pointer to the end of allocated storage.
         [[no_unique_address]] Allocator alloc_;///< Allocator used for all memory management.
 
+        /// Whether the allocator leaves construction and destruction to T itself.
+        static constexpr bool default_construct_destroy =
+                !requires(Allocator &a, T *p) { a.construct(p, std::move(*p)); } &&
+                !requires(Allocator &a, T *p) { a.destroy(p); };
+
+        /// Whether reallocation may move elements with memcpy and skip their destructors.
+        static constexpr bool relocate_bitwise = is_trivially_relocatable_v<T> && default_construct_destroy;
+
+        /// Whether the allocator can resize a buffer in place, as MmapAllocator does with mremap().
+        static constexpr bool resize_in_place =
+                relocate_bitwise && requires(Allocator &a, pointer p, size_type n) { { a.reallocate(p, n, n) } -> std::same_as<pointer>; };
+
+        /// Whether destroying an element is a no-op.
+        static constexpr bool trivial_destroy = std::is_trivially_destructible_v<T> && default_construct_destroy;
+
         // Helper functions
         /**
-         * @brief Allocates memory for n elements.
-         * @param n The number of elements to allocate.
+         * @brief Allocates memory for at least n elements.
+         * @param n The number of elements to allocate; raised to the number the
+         *          allocator actually provided if it implements allocate_at_least().
          * @return Pointer to the allocated memory.
          */
-        pointer allocate(size_type n) {
-            return n != 0 ? std::allocator_traits<Allocator>::allocate(alloc_, n) : nullptr;
+        pointer allocate(size_type &n) {
+            if (n == 0)
+                return nullptr;
+            if constexpr (requires(Allocator &a, size_type m) { a.allocate_at_least(m); }) {
+                auto [ptr, count] = alloc_.allocate_at_least(n);
+                n = std::min<size_type>(count, max_size());
+                return ptr;
+            } else {
+                return std::allocator_traits<Allocator>::allocate(alloc_, n);
+            }
         }
 
         /**
@@ -426,7 +707,7 @@ namespace userDefineDataStructure {
         }
 
         /**
-         * @brief Recommends a new capacity based on the desired size.
+         * @brief Recommends a new capacity based on the desired size, as chosen by the GrowthPolicy.
          * @param new_size The desired size.
          * @return The recommended capacity.
          * @throw std::length_error if new_size > max_size().
@@ -435,29 +716,159 @@ namespace userDefineDataStructure {
             const size_type ms = max_size();
             if (new_size > ms)
                 throw std::length_error("vector::reserve");
-            const size_type cap = capacity();
-            if (cap >= ms / 2)
-                return ms;
-            return std::max(2 * cap, new_size);
+            return std::clamp<size_type>(GrowthPolicy::capacity(capacity(), new_size, sizeof(T)), new_size, ms);
         }
 
         /**
          * @brief Reallocates the vector to have the specified new capacity.
+         * Trivially relocatable elements are moved with a single memcpy, or not
+         * at all if the allocator can resize the buffer itself.
          * @param new_cap The new capacity.
          */
         void reallocate(size_type new_cap) {
-            pointer new_begin = allocate(new_cap);
+            if constexpr (resize_in_place) {
+                if (begin_) {
+                    size_type count = size();
+                    begin_ = alloc_.reallocate(begin_, capacity(), new_cap);
+                    end_ = begin_ + count;
+                    cap_ = begin_ + new_cap;
+                    return;
+                }
+            }
+            pointer new_begin = allocate(new_cap);// may raise new_cap
             pointer new_end = new_begin;
+            if constexpr (relocate_bitwise) {
+                // The old bytes become the new objects; the originals are not destroyed.
+                new_end = move_into(begin_, end_, new_begin);
+            } else {
+                try {
+                    new_end = move_into(begin_, end_, new_begin);
+                } catch (...) {
+                    std::allocator_traits<Allocator>::deallocate(alloc_, new_begin, new_cap);
+                    throw;
+                }
+                destroy_range(begin_, end_);
+            }
+            deallocate();
+            begin_ = new_begin;
+            end_ = new_end;
+            cap_ = new_begin + new_cap;
+        }
+
+        /**
+         * @brief Constructs count elements at dest from *first, *++first, ...
+         * Goes through the allocator's construct() if it has one, so that for
+         * example polymorphic_allocator passes itself on to the elements.
+         * @return Pointer past the last constructed element; nothing is left constructed on exception.
+         */
+        template<typename InputIt>
+        pointer copy_construct(InputIt first, size_type count, pointer dest) {
+            if constexpr (default_construct_destroy) {
+                return std::ranges::uninitialized_copy_n(first, static_cast<std::iter_difference_t<InputIt>>(count), dest,
+                                                         std::unreachable_sentinel)
+                        .out;
+            } else {
+                pointer current = dest;
+                try {
+                    for (; count > 0; --count, ++first, ++current)
+                        std::allocator_traits<Allocator>::construct(alloc_, std::to_address(current), *first);
+                } catch (...) {
+                    destroy_range(dest, current);
+                    throw;
+                }
+                return current;
+            }
+        }
+
+        /**
+         * @brief Constructs count elements at dest from args, value-initialized if there are none.
+         * @return Pointer past the last constructed element; nothing is left constructed on exception.
+         */
+        template<typename... Args>
+        pointer fill_construct(pointer dest, size_type count, const Args &...args) {
+            if constexpr (default_construct_destroy) {
+                if constexpr (sizeof...(Args) == 0)
+                    return std::uninitialized_value_construct_n(dest, count);
+                else
+                    return std::uninitialized_fill_n(dest, count, args...);
+            } else {
+                pointer current = dest;
+                try {
+                    for (; count > 0; --count, ++current)
+                        std::allocator_traits<Allocator>::construct(alloc_, std::to_address(current), args...);
+                } catch (...) {
+                    destroy_range(dest, current);
+                    throw;
+                }
+                return current;
+            }
+        }
+
+        /**
+         * @brief Moves [first, last) into uninitialized storage at dest, bytewise when T is trivially relocatable.
+         * The source elements are left to be destroyed, or simply released if moved bytewise.
+         * @return Pointer past the last moved element.
+         */
+        pointer move_into(pointer first, pointer last, pointer dest) {
+            if constexpr (relocate_bitwise) {
+                if (first != last)
+                    std::memcpy(static_cast<void *>(std::to_address(dest)), std::to_address(first), (last - first) * sizeof(T));
+                return dest + (last - first);
+            } else {
+                return copy_construct(std::make_move_iterator(first), static_cast<size_type>(last - first), dest);
+            }
+        }
+
+        /**
+         * @brief Inserts count elements from first before pos, within the current capacity.
+         */
+        template<typename ForwardIt>
+        void insert_in_place(pointer pos, ForwardIt first, size_type count) {
+            auto after = static_cast<size_type>(end_ - pos);
+            pointer old_end = end_;
+            if (after > count) {
+                // Shift the tail up by count, then assign the range over the gap.
+                end_ = copy_construct(std::make_move_iterator(old_end - count), count, old_end);
+                std::move_backward(pos, old_end - count, old_end);
+                std::copy_n(first, count, pos);
+            } else {
+                // The range overhangs the old end: construct its overhang, then the moved tail after it.
+                ForwardIt middle = std::next(first, after);
+                end_ = copy_construct(middle, count - after, old_end);
+                end_ = copy_construct(std::make_move_iterator(pos), after, end_);
+                std::copy(first, middle, pos);
+            }
+        }
+
+        /**
+         * @brief Inserts count elements from first at offset, moving everything into one new allocation.
+         */
+        template<typename ForwardIt>
+        void insert_reallocate(size_type offset, ForwardIt first, size_type count) {
+            size_type new_cap = recommend(size() + count);
+            pointer new_begin = allocate(new_cap);// may raise new_cap
+            pointer inserted = new_begin + offset;
+            pointer inserted_end = inserted;
             try {
-                new_end = std::uninitialized_move(begin_, end_, new_begin);
+                inserted_end = copy_construct(first, count, inserted);
+                pointer prefix_end = move_into(begin_, begin_ + offset, new_begin);
+                try {
+                    move_into(begin_ + offset, end_, inserted_end);
+                } catch (...) {
+                    destroy_range(new_begin, prefix_end);
+                    throw;
+                }
             } catch (...) {
+                destroy_range(inserted, inserted_end);
                 std::allocator_traits<Allocator>::deallocate(alloc_, new_begin, new_cap);
                 throw;
             }
-            destroy_range(begin_, end_);
+            if constexpr (!relocate_bitwise)
+                destroy_range(begin_, end_);
+            size_type new_size = size() + count;
             deallocate();
             begin_ = new_begin;
-            end_ = new_end;
+            end_ = new_begin + new_size;
             cap_ = new_begin + new_cap;
         }
 
@@ -467,6 +878,8 @@ namespace userDefineDataStructure {
          * @param last Iterator to the element past the end of the range.
          */
         void destroy_range(pointer first, pointer last) {
+            if constexpr (trivial_destroy)
+                return;
             for (; first != last; ++first)
                 std::allocator_traits<Allocator>::destroy(alloc_, first);
         }
@@ -0,0 +1,123 @@
+#include "concurrent_hash_map.h"
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    class ConcurrentHashMapTest : public ::testing::Test {
+    protected:
+        userDefineDataStructure::ConcurrentHashMap<int, int> map{16};
+    };
+
+    TEST_F(ConcurrentHashMapTest, BasicOperations) {
+        EXPECT_TRUE(map.empty());
+        EXPECT_TRUE(map.insert_or_assign(1, 100));
+        EXPECT_FALSE(map.insert_or_assign(1, 200));
+        EXPECT_TRUE(map.contains(1));
+
+        int seen = 0;
+        EXPECT_TRUE(map.find(1, [&](const int &value) { seen = value; }));
+        EXPECT_EQ(seen, 200);
+        EXPECT_FALSE(map.find(2, [&](const int &) { seen = -1; }));
+        EXPECT_EQ(seen, 200);
+
+        EXPECT_TRUE(map.erase(1));
+        EXPECT_FALSE(map.erase(1));
+        EXPECT_EQ(map.size(), 0);
+    }
+
+    TEST_F(ConcurrentHashMapTest, ShardCountIsPowerOfTwo) {
+        userDefineDataStructure::ConcurrentHashMap<int, int> odd(5);
+        EXPECT_EQ(odd.shard_count(), 8);
+        EXPECT_EQ(std::popcount(userDefineDataStructure::ConcurrentHashMap<int, int>::default_shard_count()), 1);
+    }
+
+    TEST_F(ConcurrentHashMapTest, ForEachShardVisitsEverything) {
+        for (int i = 0; i < 1000; ++i)
+            map.insert_or_assign(i, i);
+
+        size_t total = 0, used_shards = 0;
+        map.for_each_shard([&](auto &shard) {
+            total += shard.size();
+            used_shards += !shard.empty();
+            for (auto &pair: shard)
+                pair.second *= 2;
+        });
+        EXPECT_EQ(total, 1000);
+        EXPECT_EQ(used_shards, map.shard_count());
+
+        int value = 0;
+        map.find(21, [&](const int &v) { value = v; });
+        EXPECT_EQ(value, 42);
+    }
+
+    TEST_F(ConcurrentHashMapTest, ConcurrentWritersAndReaders) {
+        const int NUM_THREADS = 8;
+        const int KEYS_PER_THREAD = 2000;
+        std::atomic<int> hits{0};
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < NUM_THREADS; ++t) {
+            threads.emplace_back([&, t] {
+                for (int i = 0; i < KEYS_PER_THREAD; ++i) {
+                    int key = t * KEYS_PER_THREAD + i;
+                    map.insert_or_assign(key, key);
+                    map.find(key, [&](const int &v) { hits += (v == key); });
+                    if (i % 4 == 0)
+                        map.erase(key);
+                }
+            });
+        }
+        for (auto &thread: threads)
+            thread.join();
+
+        EXPECT_EQ(hits.load(), NUM_THREADS * KEYS_PER_THREAD);
+        EXPECT_EQ(map.size(), NUM_THREADS * KEYS_PER_THREAD * 3 / 4);
+        for (int key = 0; key < NUM_THREADS * KEYS_PER_THREAD; ++key)
+            EXPECT_EQ(map.contains(key), key % KEYS_PER_THREAD % 4 != 0);
+    }
+
+    TEST_F(ConcurrentHashMapTest, ReadMostlyThroughput) {
+        const int NUM_KEYS = 10000;
+        const int OPS_PER_THREAD = 100000;
+        for (int i = 0; i < NUM_KEYS; ++i)
+            map.insert_or_assign(i, i);
+
+        auto run = [&](int num_threads) {
+            auto start = std::chrono::high_resolution_clock::now();
+            std::vector<std::thread> threads;
+            for (int t = 0; t < num_threads; ++t) {
+                threads.emplace_back([&, t] {
+                    unsigned state = t + 1;
+                    for (int i = 0; i < OPS_PER_THREAD; ++i) {
+                        state = state * 1103515245 + 12345;
+                        int key = static_cast<int>((state >> 8) % NUM_KEYS);
+                        if (i % 10 == 0)
+                            map.insert_or_assign(key, i);
+                        else
+                            map.contains(key);
+                    }
+                });
+            }
+            for (auto &thread: threads)
+                thread.join();
+            auto end = std::chrono::high_resolution_clock::now();
+            return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+        };
+
+        int threads = static_cast<int>(std::max(2u, std::thread::hardware_concurrency()));
+        auto single = run(1);
+        auto multi = run(threads);
+        std::cout << "90% reads, 1 thread: " << OPS_PER_THREAD << " ops in " << single << "ms" << std::endl;
+        std::cout << "90% reads, " << threads << " threads: " << OPS_PER_THREAD * threads << " ops in " << multi << "ms" << std::endl;
+
+        EXPECT_EQ(map.size(), NUM_KEYS);
+        EXPECT_LT(multi, 10000);
+    }
+
+}// namespace
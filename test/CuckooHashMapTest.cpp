@@ -0,0 +1,151 @@
+#include "concurrent_hash_map.h"
+#include "cuckoo_hash_map.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    struct Pair {
+        uint64_t key;
+        uint64_t check;
+    };
+
+    class CuckooHashMapTest : public ::testing::Test {
+    protected:
+        userDefineDataStructure::CuckooHashMap<int, int> map{16};
+    };
+
+    TEST_F(CuckooHashMapTest, BasicOperations) {
+        EXPECT_TRUE(map.empty());
+        EXPECT_TRUE(map.insert_or_assign(1, 100));
+        EXPECT_FALSE(map.insert_or_assign(1, 200));
+        EXPECT_TRUE(map.contains(1));
+        EXPECT_EQ(map.find(1), 200);
+        EXPECT_FALSE(map.find(2).has_value());
+
+        EXPECT_TRUE(map.erase(1));
+        EXPECT_FALSE(map.erase(1));
+        EXPECT_FALSE(map.contains(1));
+        EXPECT_EQ(map.size(), 0);
+    }
+
+    TEST_F(CuckooHashMapTest, DisplacementAndGrowth) {
+        const int N = 100000;
+        size_t initial_capacity = map.capacity();
+        for (int i = 0; i < N; ++i)
+            EXPECT_TRUE(map.insert_or_assign(i, i * 3));
+        EXPECT_EQ(map.size(), N);
+        EXPECT_GT(map.capacity(), initial_capacity);
+        EXPECT_GT(map.load_factor(), 0.3f);
+        for (int i = 0; i < N; ++i)
+            ASSERT_EQ(map.find(i), i * 3);
+        EXPECT_FALSE(map.contains(N));
+
+        for (int i = 0; i < N; i += 2)
+            EXPECT_TRUE(map.erase(i));
+        EXPECT_EQ(map.size(), N / 2);
+        for (int i = 0; i < N; ++i)
+            ASSERT_EQ(map.contains(i), i % 2 == 1);
+    }
+
+    TEST_F(CuckooHashMapTest, HighLoadFactorWithoutGrowth) {
+        userDefineDataStructure::CuckooHashMap<uint64_t, uint64_t> dense(1 << 16);
+        size_t capacity = dense.capacity();
+        size_t count = capacity * 95 / 100;
+        for (uint64_t i = 0; i < count; ++i)
+            dense.insert_or_assign(i * 0x9E3779B97F4A7C15ull, i);
+        EXPECT_EQ(dense.capacity(), capacity);
+        EXPECT_GT(dense.load_factor(), 0.94f);
+        for (uint64_t i = 0; i < count; ++i)
+            ASSERT_EQ(dense.find(i * 0x9E3779B97F4A7C15ull), i);
+    }
+
+    TEST_F(CuckooHashMapTest, ReadersNeverSeeTornValues) {
+        const uint64_t NUM_KEYS = 1000;
+        userDefineDataStructure::CuckooHashMap<uint64_t, Pair> pairs(64);
+        for (uint64_t k = 0; k < NUM_KEYS; ++k)
+            pairs.insert_or_assign(k, {k, ~k});
+
+        std::atomic<bool> stop{false};
+        std::atomic<size_t> torn{0}, missing{0};
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 4; ++t) {
+            readers.emplace_back([&, t] {
+                uint64_t k = t;
+                while (!stop.load(std::memory_order_relaxed)) {
+                    k = (k + 7) % NUM_KEYS;
+                    auto value = pairs.find(k);
+                    if (!value)
+                        ++missing;
+                    else if (value->check != ~value->key || value->key % NUM_KEYS != k)
+                        ++torn;
+                }
+            });
+        }
+
+        // Rewrite every key, insert and erase extra keys to force displacement
+        // and growth while the readers run.
+        for (uint64_t round = 1; round <= 20; ++round) {
+            for (uint64_t k = 0; k < NUM_KEYS; ++k) {
+                uint64_t key = k + round * NUM_KEYS;
+                pairs.insert_or_assign(k, {key, ~key});
+                pairs.insert_or_assign(key, {key, ~key});
+            }
+            for (uint64_t k = 0; k < NUM_KEYS; k += 2)
+                pairs.erase(k + round * NUM_KEYS);
+        }
+        stop = true;
+        for (auto &reader: readers)
+            reader.join();
+
+        EXPECT_EQ(torn.load(), 0);
+        EXPECT_EQ(missing.load(), 0);
+        EXPECT_EQ(pairs.size(), NUM_KEYS + 20 * NUM_KEYS / 2);
+    }
+
+    TEST_F(CuckooHashMapTest, ReadScalingAgainstShardedMap) {
+        const int NUM_KEYS = 100000;
+        const int OPS_PER_THREAD = 1000000;
+        userDefineDataStructure::CuckooHashMap<int, int> cuckoo(NUM_KEYS);
+        userDefineDataStructure::ConcurrentHashMap<int, int> sharded;
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            cuckoo.insert_or_assign(i, i);
+            sharded.insert_or_assign(i, i);
+        }
+
+        auto run = [&](int num_threads, auto &&lookup) {
+            std::atomic<long> found{0};
+            auto start = std::chrono::high_resolution_clock::now();
+            std::vector<std::thread> threads;
+            for (int t = 0; t < num_threads; ++t) {
+                threads.emplace_back([&, t] {
+                    unsigned state = t + 1;
+                    long local = 0;
+                    for (int i = 0; i < OPS_PER_THREAD; ++i) {
+                        state = state * 1103515245 + 12345;
+                        local += lookup(static_cast<int>((state >> 8) % NUM_KEYS));
+                    }
+                    found += local;
+                });
+            }
+            for (auto &thread: threads)
+                thread.join();
+            auto end = std::chrono::high_resolution_clock::now();
+            EXPECT_EQ(found.load(), static_cast<long>(num_threads) * OPS_PER_THREAD);
+            return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+        };
+
+        auto cuckoo_lookup = [&](int key) { return cuckoo.contains(key); };
+        auto sharded_lookup = [&](int key) { return sharded.contains(key); };
+        int threads = static_cast<int>(std::max(2u, std::thread::hardware_concurrency()));
+        for (int n: {1, threads}) {
+            std::cout << n << " thread(s), " << OPS_PER_THREAD << " reads each: cuckoo " << run(n, cuckoo_lookup)
+                      << "ms, sharded " << run(n, sharded_lookup) << "ms" << std::endl;
+        }
+    }
+
+}// namespace
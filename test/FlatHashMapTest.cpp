@@ -0,0 +1,149 @@
+#include "flat_hash_map.h"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+    class FlatHashMapTest : public ::testing::Test {
+    protected:
+        userDefineDataStructure::FlatHashMap<std::string, int> map;
+    };
+
+    TEST_F(FlatHashMapTest, InsertAndRetrieve) {
+        map.insert_or_assign("key1", 100);
+        EXPECT_EQ(map.at("key1"), 100);
+        EXPECT_TRUE(map.contains("key1"));
+        EXPECT_FALSE(map.contains("key2"));
+    }
+
+    TEST_F(FlatHashMapTest, UpdateExistingKey) {
+        map.insert_or_assign("key1", 100);
+        map.insert_or_assign("key1", 200);
+        EXPECT_EQ(map.at("key1"), 200);
+        EXPECT_EQ(map.size(), 1);
+    }
+
+    TEST_F(FlatHashMapTest, SubscriptOperator) {
+        map["a"] = 1;
+        map["a"] += 2;
+        EXPECT_EQ(map["a"], 3);
+        EXPECT_EQ(map["b"], 0);
+        EXPECT_EQ(map.size(), 2);
+    }
+
+    TEST_F(FlatHashMapTest, EraseElement) {
+        map.insert_or_assign("key1", 100);
+        EXPECT_TRUE(map.erase("key1"));
+        EXPECT_FALSE(map.contains("key1"));
+        EXPECT_FALSE(map.erase("key1"));
+        EXPECT_TRUE(map.empty());
+    }
+
+    TEST_F(FlatHashMapTest, ExceptionHandling) {
+        EXPECT_THROW(map.at("nonexistent"), std::out_of_range);
+        EXPECT_THROW(map.max_load_factor(0.0f), std::invalid_argument);
+    }
+
+    TEST_F(FlatHashMapTest, GrowthKeepsAllElements) {
+        const int NUM_INSERTS = 10000;
+        for (int i = 0; i < NUM_INSERTS; ++i)
+            map.insert_or_assign("key" + std::to_string(i), i);
+        EXPECT_EQ(map.size(), NUM_INSERTS);
+        EXPECT_LE(map.load_factor(), 0.875f);
+        for (int i = 0; i < NUM_INSERTS; ++i)
+            EXPECT_EQ(map.at("key" + std::to_string(i)), i);
+    }
+
+    TEST_F(FlatHashMapTest, ChurnAgainstReference) {
+        userDefineDataStructure::FlatHashMap<int, int> flat;
+        std::unordered_map<int, int> reference;
+        std::mt19937 gen(42);
+        std::uniform_int_distribution<> key(0, 2000);
+        for (int i = 0; i < 50000; ++i) {
+            int k = key(gen);
+            if (gen() % 3 == 0) {
+                EXPECT_EQ(flat.erase(k), reference.erase(k) == 1);
+            } else {
+                flat.insert_or_assign(k, i);
+                reference[k] = i;
+            }
+        }
+        EXPECT_EQ(flat.size(), reference.size());
+        for (const auto &[k, v]: reference)
+            EXPECT_EQ(flat.at(k), v);
+
+        size_t visited = 0;
+        for (const auto &pair: flat) {
+            EXPECT_EQ(reference.at(pair.first), pair.second);
+            ++visited;
+        }
+        EXPECT_EQ(visited, reference.size());
+    }
+
+    TEST_F(FlatHashMapTest, CopyAndMove) {
+        for (int i = 0; i < 100; ++i)
+            map.insert_or_assign(std::to_string(i), i);
+
+        userDefineDataStructure::FlatHashMap<std::string, int> copy = map;
+        EXPECT_EQ(copy.size(), 100);
+        EXPECT_EQ(copy.at("42"), 42);
+
+        userDefineDataStructure::FlatHashMap<std::string, int> moved = std::move(map);
+        EXPECT_EQ(moved.size(), 100);
+        EXPECT_EQ(moved.at("99"), 99);
+        EXPECT_TRUE(map.empty());
+        EXPECT_FALSE(map.contains("1"));
+    }
+
+    TEST_F(FlatHashMapTest, ClearAndReuse) {
+        for (int i = 0; i < 100; ++i)
+            map.insert_or_assign(std::to_string(i), i);
+        size_t buckets = map.bucket_count();
+        map.clear();
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(map.bucket_count(), buckets);
+        map.insert_or_assign("x", 1);
+        EXPECT_EQ(map.at("x"), 1);
+    }
+
+    TEST_F(FlatHashMapTest, ReserveAvoidsGrowth) {
+        map.reserve(1000);
+        size_t buckets = map.bucket_count();
+        for (int i = 0; i < 1000; ++i)
+            map.insert_or_assign(std::to_string(i), i);
+        EXPECT_EQ(map.bucket_count(), buckets);
+    }
+
+    TEST_F(FlatHashMapTest, PerformanceTest) {
+        const int NUM_OPERATIONS = 100000;
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_int_distribution<> dis(0, NUM_OPERATIONS - 1);
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < NUM_OPERATIONS; ++i) {
+            map.insert_or_assign(std::to_string(i), i);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto insert_duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+        start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < NUM_OPERATIONS; ++i) {
+            int key = dis(gen);
+            map.contains(std::to_string(key));
+        }
+        end = std::chrono::high_resolution_clock::now();
+        auto lookup_duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+        std::cout << "Insert " << NUM_OPERATIONS << " elements: " << insert_duration.count() << "ms" << std::endl;
+        std::cout << "Lookup " << NUM_OPERATIONS << " times: " << lookup_duration.count() << "ms" << std::endl;
+
+        EXPECT_LT(insert_duration.count(), 5000);
+        EXPECT_LT(lookup_duration.count(), 5000);
+    }
+
+}// namespace
@@ -0,0 +1,95 @@
+#include "frozen_hash_map.h"
+#include "hash_table.h"
+#include <chrono>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+    TEST(FrozenHashMapTest, FreezeHashMap) {
+        const int NUM_KEYS = 10000;
+        userDefineDataStructure::HashMap<std::string, int> map;
+        for (int i = 0; i < NUM_KEYS; ++i)
+            map.insert_or_assign("key" + std::to_string(i), i);
+
+        auto frozen = map.freeze();
+        EXPECT_EQ(frozen.size(), NUM_KEYS);
+        for (int i = 0; i < NUM_KEYS; ++i)
+            EXPECT_EQ(frozen.at("key" + std::to_string(i)), i);
+        for (int i = NUM_KEYS; i < 2 * NUM_KEYS; ++i)
+            EXPECT_FALSE(frozen.contains("key" + std::to_string(i)));
+        EXPECT_THROW(frozen.at("missing"), std::out_of_range);
+        EXPECT_EQ(map.size(), NUM_KEYS);
+
+        size_t visited = 0;
+        for (const auto &pair: frozen) {
+            EXPECT_EQ(map.at(pair.first), pair.second);
+            ++visited;
+        }
+        EXPECT_EQ(visited, NUM_KEYS);
+    }
+
+    TEST(FrozenHashMapTest, InitializerListAndSmallSizes) {
+        userDefineDataStructure::FrozenHashMap<std::string, int> ports = {{"http", 80}, {"https", 443}, {"ssh", 22}};
+        EXPECT_EQ(ports.at("https"), 443);
+        EXPECT_EQ(ports.find("ftp"), ports.end());
+        EXPECT_EQ(ports.find("ssh")->second, 22);
+
+        userDefineDataStructure::FrozenHashMap<int, int> empty;
+        EXPECT_TRUE(empty.empty());
+        EXPECT_FALSE(empty.contains(1));
+        EXPECT_EQ(empty.begin(), empty.end());
+
+        for (int n = 1; n < 40; ++n) {
+            std::vector<std::pair<int, int>> items;
+            for (int i = 0; i < n; ++i)
+                items.emplace_back(i * 31, i);
+            userDefineDataStructure::FrozenHashMap<int, int> small(items.begin(), items.end());
+            EXPECT_EQ(small.size(), n);
+            for (int i = 0; i < n; ++i)
+                EXPECT_EQ(small.at(i * 31), i);
+            EXPECT_FALSE(small.contains(-1));
+        }
+    }
+
+    TEST(FrozenHashMapTest, RejectsDuplicateKeys) {
+        std::vector<std::pair<int, int>> items = {{1, 1}, {2, 2}, {1, 3}};
+        EXPECT_THROW((userDefineDataStructure::FrozenHashMap<int, int>(items.begin(), items.end())), std::invalid_argument);
+    }
+
+    TEST(FrozenHashMapTest, PerformanceTest) {
+        const int NUM_KEYS = 200000;
+        userDefineDataStructure::HashMap<uint64_t, uint64_t> map;
+        std::mt19937_64 gen(3);
+        std::vector<uint64_t> keys(NUM_KEYS);
+        for (auto &key: keys) {
+            key = gen();
+            map.insert_or_assign(key, key / 2);
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        auto frozen = map.freeze();
+        auto built = std::chrono::high_resolution_clock::now();
+
+        std::shuffle(keys.begin(), keys.end(), gen);
+        uint64_t sum_chained = 0, sum_frozen = 0;
+        auto chained_start = std::chrono::high_resolution_clock::now();
+        for (uint64_t key: keys)
+            sum_chained += map.at(key);
+        auto frozen_start = std::chrono::high_resolution_clock::now();
+        for (uint64_t key: keys)
+            sum_frozen += frozen.at(key);
+        auto end = std::chrono::high_resolution_clock::now();
+
+        EXPECT_EQ(sum_chained, sum_frozen);
+        auto ms = [](auto d) { return std::chrono::duration_cast<std::chrono::milliseconds>(d).count(); };
+        std::cout << "Freeze " << NUM_KEYS << " elements: " << ms(built - start) << "ms, "
+                  << frozen.memory_usage() / NUM_KEYS << " bytes per entry" << std::endl;
+        std::cout << "HashMap lookups: " << ms(frozen_start - chained_start) << "ms" << std::endl;
+        std::cout << "FrozenHashMap lookups: " << ms(end - frozen_start) << "ms" << std::endl;
+        EXPECT_LT(ms(built - start), 10000);
+    }
+
+}// namespace
@@ -0,0 +1,140 @@
+#include "hash_map_snapshot.h"
+#include "hash_table.h"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+#include <unordered_map>
+
+namespace {
+
+    class HashMapSnapshotTest : public ::testing::Test {
+    protected:
+        std::filesystem::path path;
+
+        void SetUp() override {
+            path = std::filesystem::temp_directory_path() /
+                   ("snapshot_test_" + std::to_string(::getpid()) + "_" +
+                    ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        }
+
+        void TearDown() override {
+            std::filesystem::remove(path);
+        }
+    };
+
+    struct Point {
+        int32_t x;
+        int32_t y;
+    };
+
+    TEST_F(HashMapSnapshotTest, RawKeysAndValues) {
+        userDefineDataStructure::HashMap<uint64_t, Point> map;
+        for (uint64_t i = 0; i < 5000; ++i)
+            map.insert_or_assign(i * 977, Point{static_cast<int32_t>(i), -static_cast<int32_t>(i)});
+        userDefineDataStructure::write_snapshot(path, map);
+
+        userDefineDataStructure::MappedHashMap<uint64_t, Point> mapped(path);
+        EXPECT_EQ(mapped.size(), 5000);
+        for (uint64_t i = 0; i < 5000; ++i) {
+            const Point &p = mapped.at(i * 977);
+            EXPECT_EQ(p.x, static_cast<int32_t>(i));
+            EXPECT_EQ(p.y, -static_cast<int32_t>(i));
+        }
+        EXPECT_FALSE(mapped.contains(1));
+        EXPECT_THROW(mapped.at(1), std::out_of_range);
+    }
+
+    TEST_F(HashMapSnapshotTest, StringKeysAndValues) {
+        std::unordered_map<std::string, std::string> source;
+        for (int i = 0; i < 1000; ++i)
+            source["key" + std::to_string(i)] = std::string(static_cast<size_t>(i % 50), 'v') + std::to_string(i);
+        source[""] = "empty key";
+        userDefineDataStructure::write_snapshot(path, source);
+
+        userDefineDataStructure::MappedHashMap<std::string, std::string> mapped(path);
+        EXPECT_EQ(mapped.size(), source.size());
+        for (const auto &[key, value]: source)
+            EXPECT_EQ(mapped.at(key), value);
+        EXPECT_FALSE(mapped.contains("key1000"));
+
+        size_t visited = 0;
+        mapped.for_each([&](std::string_view key, std::string_view value) {
+            EXPECT_EQ(source.at(std::string(key)), value);
+            ++visited;
+        });
+        EXPECT_EQ(visited, source.size());
+
+        userDefineDataStructure::MappedHashMap<std::string, std::string> moved = std::move(mapped);
+        EXPECT_EQ(moved.at("key7"), source.at("key7"));
+    }
+
+    TEST_F(HashMapSnapshotTest, EmptyMap) {
+        userDefineDataStructure::HashMap<std::string, int> map;
+        userDefineDataStructure::write_snapshot(path, map);
+        userDefineDataStructure::MappedHashMap<std::string, int> mapped(path);
+        EXPECT_TRUE(mapped.empty());
+        EXPECT_FALSE(mapped.contains("anything"));
+    }
+
+    TEST_F(HashMapSnapshotTest, RejectsMismatchedOrCorruptFiles) {
+        userDefineDataStructure::HashMap<std::string, int> map;
+        map.insert_or_assign("a", 1);
+        userDefineDataStructure::write_snapshot(path, map);
+
+        using WrongValue = userDefineDataStructure::MappedHashMap<std::string, int64_t>;
+        EXPECT_THROW(WrongValue{path}, std::runtime_error);
+
+        std::filesystem::resize_file(path, 100);
+        using Right = userDefineDataStructure::MappedHashMap<std::string, int>;
+        EXPECT_THROW(Right{path}, std::runtime_error);
+
+        {
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            out << "definitely not a snapshot file, but long enough to hold a header of ninety-six bytes...";
+        }
+        EXPECT_THROW(Right{path}, std::runtime_error);
+        EXPECT_THROW(Right{path.string() + ".missing"}, std::runtime_error);
+    }
+
+    TEST_F(HashMapSnapshotTest, FailedWriteRemovesTemporaryFile) {
+        // A non-empty directory at path makes the final rename fail.
+        std::filesystem::create_directory(path);
+        std::ofstream(path / "occupied") << "x";
+        userDefineDataStructure::HashMap<uint64_t, uint64_t> map;
+        map.insert_or_assign(1, 2);
+        EXPECT_THROW(userDefineDataStructure::write_snapshot(path, map), std::filesystem::filesystem_error);
+
+        std::filesystem::path temp = path;
+        temp += ".tmp";
+        EXPECT_FALSE(std::filesystem::exists(temp));
+        EXPECT_TRUE(std::filesystem::exists(path / "occupied"));
+        std::filesystem::remove_all(path);
+    }
+
+    TEST_F(HashMapSnapshotTest, PerformanceTest) {
+        const uint64_t NUM_KEYS = 500000;
+        userDefineDataStructure::HashMap<uint64_t, uint64_t> map;
+        map.reserve(NUM_KEYS);
+        for (uint64_t i = 0; i < NUM_KEYS; ++i)
+            map.insert_or_assign(i, i * 3);
+
+        auto start = std::chrono::high_resolution_clock::now();
+        userDefineDataStructure::write_snapshot(path, map);
+        auto written = std::chrono::high_resolution_clock::now();
+        userDefineDataStructure::MappedHashMap<uint64_t, uint64_t> mapped(path);
+        auto opened = std::chrono::high_resolution_clock::now();
+        userDefineDataStructure::HashMap<uint64_t, uint64_t> rebuilt;
+        for (uint64_t i = 0; i < NUM_KEYS; ++i)
+            rebuilt.insert_or_assign(i, mapped.at(i));
+        auto end = std::chrono::high_resolution_clock::now();
+
+        auto us = [](auto d) { return std::chrono::duration_cast<std::chrono::microseconds>(d).count(); };
+        std::cout << "Write snapshot of " << NUM_KEYS << " entries: " << us(written - start) / 1000 << "ms" << std::endl;
+        std::cout << "Open snapshot: " << us(opened - written) << "us" << std::endl;
+        std::cout << "Rebuild HashMap key by key: " << us(end - opened) / 1000 << "ms" << std::endl;
+        EXPECT_EQ(rebuilt.size(), NUM_KEYS);
+    }
+
+}// namespace
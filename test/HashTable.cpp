@@ -1,7 +1,14 @@
+#include "hash.h"
 #include "hash_table.h"
+#include <atomic>
+#include <bit>
 #include <gtest/gtest.h>
+#include <list>
 #include <random>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
 #include <vector>
 
 namespace {
@@ -135,6 +142,752 @@ namespace {
         EXPECT_EQ(map.size(), 0);
     }
 
+    TEST_F(HashMapTest, IncrementalRehash) {
+        userDefineDataStructure::HashMap<int, int> intMap(16);
+        intMap.incremental_rehash(2);
+        EXPECT_EQ(intMap.incremental_rehash(), 2);
+
+        bool saw_migration = false;
+        const int NUM_INSERTS = 5000;
+        for (int i = 0; i < NUM_INSERTS; ++i) {
+            intMap.insert_or_assign(i, i * 10);
+            saw_migration = saw_migration || intMap.rehash_in_progress();
+            if (i % 97 == 0) {
+                for (int j = 0; j <= i; ++j)
+                    ASSERT_EQ(intMap.at(j), j * 10);
+            }
+        }
+        EXPECT_TRUE(saw_migration);
+        EXPECT_EQ(intMap.size(), NUM_INSERTS);
+        EXPECT_LE(intMap.load_factor(), intMap.max_load_factor());
+    }
+
+    TEST_F(HashMapTest, IncrementalRehashIterationAndErase) {
+        userDefineDataStructure::HashMap<int, int> intMap(16);
+        intMap.incremental_rehash(1);
+        int i = 0;
+        while (!intMap.rehash_in_progress()) {
+            intMap.insert_or_assign(i, i);
+            ++i;
+        }
+
+        size_t visited = 0;
+        for (const auto &pair: intMap) {
+            EXPECT_EQ(pair.first, pair.second);
+            ++visited;
+        }
+        EXPECT_EQ(visited, intMap.size());
+
+        EXPECT_TRUE(intMap.erase(0));
+        EXPECT_FALSE(intMap.contains(0));
+        EXPECT_TRUE(intMap.contains(i - 1));
+
+        intMap.incremental_rehash(0);
+        EXPECT_FALSE(intMap.rehash_in_progress());
+        for (int j = 1; j < i; ++j)
+            EXPECT_EQ(intMap.at(j), j);
+    }
+
+    TEST_F(HashMapTest, RehashRelinksNodes) {
+        for (int i = 0; i < 100; ++i)
+            map.insert_or_assign("key" + std::to_string(i), i);
+        const int *address = &map.at("key7");
+
+        map.rehash(map.bucket_count() * 8);
+        EXPECT_EQ(&map.at("key7"), address);
+        EXPECT_EQ(map.size(), 100);
+        for (int i = 0; i < 100; ++i)
+            EXPECT_EQ(map.at("key" + std::to_string(i)), i);
+    }
+
+    struct CountingHash {
+        static inline size_t calls = 0;
+
+        std::size_t operator()(const std::string &key) const {
+            ++calls;
+            return std::hash<std::string>()(key);
+        }
+    };
+
+    struct CachedHashPolicy : userDefineDataStructure::HashMapPolicy {
+        static constexpr bool cache_hash_code = true;
+    };
+
+    TEST_F(HashMapTest, CachedHashSkipsRehashing) {
+        userDefineDataStructure::HashMap<std::string, int, CountingHash, CachedHashPolicy> cached;
+        userDefineDataStructure::HashMap<std::string, int, CountingHash> uncached;
+        for (int i = 0; i < 1000; ++i) {
+            cached.insert_or_assign("key" + std::to_string(i), i);
+            uncached.insert_or_assign("key" + std::to_string(i), i);
+        }
+
+        CountingHash::calls = 0;
+        cached.rehash(cached.bucket_count() * 4);
+        EXPECT_EQ(CountingHash::calls, 0);
+
+        uncached.rehash(uncached.bucket_count() * 4);
+        EXPECT_EQ(CountingHash::calls, 1000);
+
+        for (int i = 0; i < 1000; ++i)
+            EXPECT_EQ(cached.at("key" + std::to_string(i)), i);
+        EXPECT_TRUE(cached.erase("key5"));
+        EXPECT_FALSE(cached.contains("key5"));
+        EXPECT_EQ(cached.size(), 999);
+    }
+
+    struct PowerOfTwoPolicy : userDefineDataStructure::HashMapPolicy {
+        using bucket_policy = userDefineDataStructure::PowerOfTwoBucketPolicy;
+    };
+
+    template<typename Map>
+    size_t longest_chain(const Map &m) {
+        size_t longest = 0;
+        for (size_t i = 0; i < m.bucket_count(); ++i)
+            longest = std::max(longest, m.bucket_size(i));
+        return longest;
+    }
+
+    TEST_F(HashMapTest, PowerOfTwoBucketPolicy) {
+        userDefineDataStructure::HashMap<uint64_t, int, std::hash<uint64_t>, PowerOfTwoPolicy> masked(10);
+        EXPECT_EQ(masked.bucket_count(), 16);
+        masked.rehash(100);
+        EXPECT_EQ(masked.bucket_count(), 128);
+
+        // Identity-hashed keys with a power-of-two stride would share one bucket
+        // under a plain mask; the mixer must spread them.
+        for (uint64_t i = 0; i < 1000; ++i)
+            masked.insert_or_assign(i << 12, static_cast<int>(i));
+        EXPECT_EQ(std::popcount(masked.bucket_count()), 1);
+        EXPECT_LE(longest_chain(masked), 4);
+        for (uint64_t i = 0; i < 1000; ++i)
+            EXPECT_EQ(masked.at(i << 12), static_cast<int>(i));
+    }
+
+    template<typename Map>
+    std::pair<long long, long long> time_insert_lookup(Map &m, const std::vector<uint64_t> &keys) {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < keys.size(); ++i)
+            m.insert_or_assign(keys[i], static_cast<int>(i));
+        auto middle = std::chrono::high_resolution_clock::now();
+        size_t found = 0;
+        for (int round = 0; round < 4; ++round)
+            for (uint64_t key: keys)
+                found += m.contains(key);
+        auto end = std::chrono::high_resolution_clock::now();
+        EXPECT_EQ(found, keys.size() * 4);
+        return {std::chrono::duration_cast<std::chrono::microseconds>(middle - start).count(),
+                std::chrono::duration_cast<std::chrono::microseconds>(end - middle).count()};
+    }
+
+    TEST_F(HashMapTest, BucketPolicyBenchmark) {
+        const uint64_t NUM_KEYS = 20000;
+        std::vector<uint64_t> sequential, strided;
+        for (uint64_t i = 0; i < NUM_KEYS; ++i) {
+            sequential.push_back(i);
+            strided.push_back(i << 10);
+        }
+
+        for (const auto &[name, keys]: {std::pair{"sequential", &sequential}, std::pair{"stride 1024", &strided}}) {
+            userDefineDataStructure::HashMap<uint64_t, int> modulo;
+            userDefineDataStructure::HashMap<uint64_t, int, std::hash<uint64_t>, PowerOfTwoPolicy> masked;
+            auto [modulo_insert, modulo_lookup] = time_insert_lookup(modulo, *keys);
+            auto [masked_insert, masked_lookup] = time_insert_lookup(masked, *keys);
+
+            std::cout << name << " keys, modulo:   insert " << modulo_insert << "us, lookup " << modulo_lookup
+                      << "us, longest chain " << longest_chain(modulo) << std::endl;
+            std::cout << name << " keys, pow2+mix: insert " << masked_insert << "us, lookup " << masked_lookup
+                      << "us, longest chain " << longest_chain(masked) << std::endl;
+            EXPECT_LE(longest_chain(masked), 4);
+        }
+    }
+
+    TEST_F(HashMapTest, BatchedLookup) {
+        for (int i = 0; i < 100; ++i)
+            map.insert_or_assign("key" + std::to_string(i), i);
+
+        std::vector<std::string> keys;
+        for (int i = 0; i < 50; ++i)
+            keys.push_back("key" + std::to_string(i * 3));
+        std::vector<const int *> values(keys.size());
+        std::unique_ptr<bool[]> present(new bool[keys.size()]);
+
+        const auto &const_map = map;
+        EXPECT_EQ(const_map.find_many(keys, values), 34);
+        EXPECT_EQ(map.contains_many(keys, std::span<bool>(present.get(), keys.size())), 34);
+        for (size_t i = 0; i < keys.size(); ++i) {
+            EXPECT_EQ(present[i], map.contains(keys[i]));
+            if (present[i])
+                EXPECT_EQ(*values[i], map.at(keys[i]));
+            else
+                EXPECT_EQ(values[i], nullptr);
+        }
+
+        std::vector<int *> mutable_values(keys.size());
+        map.find_many(keys, mutable_values);
+        *mutable_values[0] = -1;
+        EXPECT_EQ(map.at("key0"), -1);
+
+        std::vector<const int *> too_short(1);
+        EXPECT_THROW(const_map.find_many(keys, too_short), std::invalid_argument);
+    }
+
+    TEST_F(HashMapTest, BatchedLookupPerformance) {
+        const int NUM_KEYS = 200000;
+        userDefineDataStructure::HashMap<uint64_t, uint64_t> big;
+        big.reserve(NUM_KEYS);
+        for (uint64_t i = 0; i < NUM_KEYS; ++i)
+            big.insert_or_assign(i * 7919, i);
+
+        std::mt19937_64 gen(7);
+        std::vector<uint64_t> probes(NUM_KEYS);
+        for (auto &probe: probes)
+            probe = (gen() % NUM_KEYS) * 7919;
+
+        auto start = std::chrono::high_resolution_clock::now();
+        size_t single_found = 0;
+        for (uint64_t key: probes)
+            single_found += big.contains(key);
+        auto middle = std::chrono::high_resolution_clock::now();
+        std::vector<const uint64_t *> results(probes.size());
+        size_t batch_found = std::as_const(big).find_many(probes, results);
+        auto end = std::chrono::high_resolution_clock::now();
+
+        EXPECT_EQ(single_found, probes.size());
+        EXPECT_EQ(batch_found, probes.size());
+        std::cout << "One at a time: " << std::chrono::duration_cast<std::chrono::milliseconds>(middle - start).count() << "ms" << std::endl;
+        std::cout << "find_many:     " << std::chrono::duration_cast<std::chrono::milliseconds>(end - middle).count() << "ms" << std::endl;
+    }
+
+    struct ConstantHash {
+        size_t operator()(int) const { return 42; }
+    };
+
+    struct TreeifyPolicy : userDefineDataStructure::HashMapPolicy {
+        static constexpr size_t treeify_threshold = 8;
+    };
+
+    TEST_F(HashMapTest, TreeifiedBuckets) {
+        const int NUM_KEYS = 2000;
+        userDefineDataStructure::HashMap<int, int, ConstantHash, TreeifyPolicy> skewed;
+        for (int i = 0; i < NUM_KEYS; ++i)
+            skewed.insert_or_assign(i, i);
+        EXPECT_EQ(skewed.size(), NUM_KEYS);
+        EXPECT_EQ(skewed.bucket_size(skewed.bucket(0)), NUM_KEYS);
+        for (int i = 0; i < NUM_KEYS; ++i)
+            EXPECT_EQ(skewed.at(i), i);
+        EXPECT_FALSE(skewed.contains(NUM_KEYS));
+
+        auto copy = skewed;
+        for (int i = 0; i < NUM_KEYS; i += 2)
+            EXPECT_TRUE(copy.erase(i));
+        for (int i = 0; i < NUM_KEYS; ++i)
+            EXPECT_EQ(copy.contains(i), i % 2 == 1);
+        EXPECT_EQ(skewed.size(), NUM_KEYS);
+
+        for (auto it = copy.begin(); it != copy.end();)
+            it = it->first > 5 ? copy.erase(it) : ++it;
+        EXPECT_EQ(copy.size(), 3);
+        for (int i = 0; i < 12; ++i)
+            copy[i] = -i;
+        for (int i = 0; i < 12; ++i)
+            EXPECT_EQ(copy.at(i), -i);
+
+        skewed.incremental_rehash(1);
+        skewed.rehash(4096);
+        for (int i = 0; i < NUM_KEYS; ++i)
+            EXPECT_EQ(skewed.at(i), i);
+    }
+
+    TEST_F(HashMapTest, TreeifyBenchmark) {
+        const int NUM_KEYS = 4000;
+        auto run = [&](auto &skewed) {
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < NUM_KEYS; ++i)
+                skewed.insert_or_assign(i, i);
+            size_t found = 0;
+            for (int i = 0; i < NUM_KEYS; ++i)
+                found += skewed.contains(i);
+            auto end = std::chrono::high_resolution_clock::now();
+            EXPECT_EQ(found, NUM_KEYS);
+            return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+        };
+
+        userDefineDataStructure::HashMap<int, int, ConstantHash> chained;
+        userDefineDataStructure::HashMap<int, int, ConstantHash, TreeifyPolicy> treeified;
+        auto chained_ms = run(chained);
+        auto treeified_ms = run(treeified);
+        std::cout << "Single-bucket chain, " << NUM_KEYS << " keys: " << chained_ms << "ms" << std::endl;
+        std::cout << "Single-bucket tree,  " << NUM_KEYS << " keys: " << treeified_ms << "ms" << std::endl;
+    }
+
+    struct StatsPolicy : userDefineDataStructure::HashMapPolicy {
+        static constexpr bool collect_stats = true;
+    };
+
+    TEST_F(HashMapTest, Statistics) {
+        userDefineDataStructure::HashMap<int, int, std::hash<int>, StatsPolicy> counted(4);
+        for (int i = 0; i < 100; ++i)
+            counted.insert_or_assign(i, i);
+
+        auto stats = counted.stats();
+        EXPECT_EQ(stats.lookups, 100);
+        EXPECT_EQ(stats.allocations, 100 + stats.rehashes);
+        EXPECT_GE(stats.rehashes, 5);
+        EXPECT_GT(stats.rehash_time.count(), 0);
+
+        size_t buckets = 0, entries = 0;
+        for (size_t length = 0; length < stats.chain_length_histogram.size(); ++length) {
+            buckets += stats.chain_length_histogram[length];
+            entries += length * stats.chain_length_histogram[length];
+        }
+        EXPECT_EQ(buckets, counted.bucket_count());
+        EXPECT_EQ(entries, counted.size());
+
+        counted.reset_stats();
+        EXPECT_TRUE(counted.contains(42));
+        EXPECT_FALSE(counted.contains(1000));
+        stats = counted.stats();
+        EXPECT_EQ(stats.lookups, 2);
+        EXPECT_GE(stats.comparisons, 1);
+        EXPECT_EQ(stats.rehashes, 0);
+
+        userDefineDataStructure::HashMap<int, int, ConstantHash, StatsPolicy> skewed;
+        for (int i = 0; i < 50; ++i)
+            skewed.insert_or_assign(i, i);
+        skewed.reset_stats();
+        skewed.contains(49);
+        EXPECT_EQ(skewed.stats().max_comparisons, 50);
+        EXPECT_EQ(skewed.stats().chain_length_histogram.size(), 51);
+        EXPECT_DOUBLE_EQ(skewed.stats().average_comparisons(), 50.0);
+
+        static_assert(sizeof(userDefineDataStructure::HashMap<int, int>) <
+                      sizeof(userDefineDataStructure::HashMap<int, int, std::hash<int>, StatsPolicy>));
+    }
+
+    TEST_F(HashMapTest, RangeConstruction) {
+        std::vector<std::pair<std::string, int>> rows;
+        for (int i = 0; i < 1000; ++i)
+            rows.emplace_back("key" + std::to_string(i % 800), i);
+
+        userDefineDataStructure::HashMap<std::string, int> loaded(rows.begin(), rows.end());
+        EXPECT_EQ(loaded.size(), 800);
+        for (int i = 0; i < 800; ++i)
+            EXPECT_EQ(loaded.at("key" + std::to_string(i)), i);
+        EXPECT_LE(loaded.load_factor(), loaded.max_load_factor());
+
+        std::list<std::pair<int, int>> linked = {{1, 10}, {2, 20}, {1, 30}};
+        userDefineDataStructure::HashMap<int, int> from_list(linked.begin(), linked.end());
+        EXPECT_EQ(from_list.size(), 2);
+        EXPECT_EQ(from_list.at(1), 10);
+
+        userDefineDataStructure::HashMap<std::string, int> listed = {{"a", 1}, {"b", 2}};
+        EXPECT_EQ(listed.at("b"), 2);
+
+        std::vector<std::pair<std::string, std::string>> movable = {{"k", std::string(100, 'x')}};
+        userDefineDataStructure::HashMap<std::string, std::string> moved(std::make_move_iterator(movable.begin()),
+                                                                        std::make_move_iterator(movable.end()));
+        EXPECT_EQ(moved.at("k").size(), 100);
+        EXPECT_TRUE(movable[0].second.empty());
+    }
+
+    TEST_F(HashMapTest, BulkInsertSizesOnce) {
+        const int NUM_ROWS = 100000;
+        std::vector<std::pair<int, int>> rows;
+        for (int i = 0; i < NUM_ROWS; ++i)
+            rows.emplace_back(i, -i);
+
+        userDefineDataStructure::HashMap<int, int, std::hash<int>, StatsPolicy> counted;
+        counted.insert_or_assign(0, 42);
+        counted.insert(rows.begin(), rows.end(), 4);
+        EXPECT_EQ(counted.stats().rehashes, 1);
+        EXPECT_EQ(counted.size(), NUM_ROWS);
+        EXPECT_EQ(counted.at(0), 42);
+        for (int i = 1; i < NUM_ROWS; ++i)
+            EXPECT_EQ(counted.at(i), -i);
+    }
+
+    TEST_F(HashMapTest, BulkInsertPerformance) {
+        const int NUM_ROWS = 1000000;
+        std::vector<std::pair<uint64_t, uint64_t>> rows(NUM_ROWS);
+        std::mt19937_64 gen(11);
+        for (auto &row: rows)
+            row = {gen(), gen()};
+
+        auto start = std::chrono::high_resolution_clock::now();
+        userDefineDataStructure::HashMap<uint64_t, uint64_t> one_by_one;
+        for (const auto &row: rows)
+            one_by_one.insert_or_assign(row.first, row.second);
+        auto middle = std::chrono::high_resolution_clock::now();
+        userDefineDataStructure::HashMap<uint64_t, uint64_t> bulk;
+        bulk.insert(rows.begin(), rows.end(), 0);
+        auto end = std::chrono::high_resolution_clock::now();
+
+        EXPECT_EQ(bulk.size(), one_by_one.size());
+        std::cout << "insert_or_assign " << NUM_ROWS << " rows: " << std::chrono::duration_cast<std::chrono::milliseconds>(middle - start).count() << "ms" << std::endl;
+        std::cout << "insert(first, last): " << std::chrono::duration_cast<std::chrono::milliseconds>(end - middle).count() << "ms" << std::endl;
+    }
+
+    struct NoEquality {
+        int value = 0;
+    };
+
+    TEST_F(HashMapTest, EraseWhileIterating) {
+        userDefineDataStructure::HashMap<int, NoEquality> values(8);
+        values.incremental_rehash(1);
+        for (int i = 0; i < 200; ++i)
+            values.try_emplace(i, NoEquality{i});
+        EXPECT_TRUE(values.rehash_in_progress());
+
+        for (auto it = values.begin(); it != values.end();)
+            it = it->second.value % 2 == 0 ? values.erase(it) : ++it;
+
+        EXPECT_EQ(values.size(), 100);
+        size_t visited = 0;
+        for (auto &pair: values) {
+            EXPECT_EQ(pair.first % 2, 1);
+            ++visited;
+        }
+        EXPECT_EQ(visited, 100);
+        for (int i = 0; i < 200; ++i)
+            EXPECT_EQ(values.contains(i), i % 2 == 1);
+
+        auto it = values.find(7);
+        ASSERT_NE(it, values.end());
+        EXPECT_EQ(it->second.value, 7);
+        values.erase(it);
+        EXPECT_EQ(values.find(7), values.end());
+        EXPECT_TRUE(values.erase(9));
+        EXPECT_FALSE(values.erase(9));
+        EXPECT_EQ(values.size(), 98);
+    }
+
+    struct CopyCounter {
+        static inline int copies = 0;
+        std::string payload;
+
+        explicit CopyCounter(std::string p = "") : payload(std::move(p)) {}
+        CopyCounter(const CopyCounter &other) : payload(other.payload) { ++copies; }
+        CopyCounter(CopyCounter &&) noexcept = default;
+        CopyCounter &operator=(const CopyCounter &other) {
+            payload = other.payload;
+            ++copies;
+            return *this;
+        }
+        CopyCounter &operator=(CopyCounter &&) noexcept = default;
+    };
+
+    TEST_F(HashMapTest, EmplaceWithoutCopies) {
+        userDefineDataStructure::HashMap<std::string, CopyCounter> values;
+        CopyCounter::copies = 0;
+
+        values.insert_or_assign("a", CopyCounter("first"));
+        auto [it, inserted] = values.try_emplace("b", "second");
+        EXPECT_TRUE(inserted);
+        EXPECT_EQ(it->first, "b");
+        EXPECT_EQ(it->second.payload, "second");
+
+        auto [existing, again] = values.try_emplace("b", "ignored");
+        EXPECT_FALSE(again);
+        EXPECT_EQ(existing->second.payload, "second");
+
+        auto [placed, fresh] = values.emplace(std::piecewise_construct, std::forward_as_tuple("c"),
+                                              std::forward_as_tuple("third"));
+        EXPECT_TRUE(fresh);
+        EXPECT_EQ(placed->second.payload, "third");
+        EXPECT_FALSE(values.emplace("c", CopyCounter("dup")).second);
+
+        values.insert_or_assign("a", CopyCounter("updated"));
+        values["d"].payload = "fourth";
+        EXPECT_EQ(CopyCounter::copies, 0);
+
+        EXPECT_EQ(values.size(), 4);
+        EXPECT_EQ(values.at("a").payload, "updated");
+        EXPECT_EQ(values.at("c").payload, "third");
+        EXPECT_EQ(values.at("d").payload, "fourth");
+
+        CopyCounter lvalue("copied");
+        values.insert_or_assign("e", lvalue);
+        EXPECT_EQ(CopyCounter::copies, 1);
+    }
+
+    TEST_F(HashMapTest, SubscriptOperator) {
+        map["a"] = 1;
+        map["a"] += 2;
+        EXPECT_EQ(map["a"], 3);
+        EXPECT_EQ(map["b"], 0);
+        EXPECT_EQ(map.size(), 2);
+
+        userDefineDataStructure::HashMap<int, int> incremental(4);
+        incremental.incremental_rehash(1);
+        for (int i = 0; i < 100; ++i) {
+            auto [it, inserted] = incremental.try_emplace(i, i * 2);
+            EXPECT_TRUE(inserted);
+            EXPECT_EQ(it->first, i);
+            EXPECT_EQ(incremental[i], i * 2);
+        }
+        EXPECT_EQ(incremental.size(), 100);
+    }
+
+    struct CountedName {
+        static inline int conversions = 0;
+        std::string text;
+
+        CountedName(std::string_view view) : text(view) { ++conversions; }
+        bool operator==(const CountedName &other) const { return text == other.text; }
+        bool operator==(std::string_view view) const { return text == view; }
+        bool operator<(const CountedName &other) const { return text < other.text; }
+        friend bool operator<(const CountedName &a, std::string_view b) { return a.text < b; }
+        friend bool operator<(std::string_view a, const CountedName &b) { return a < b.text; }
+    };
+
+    struct CountedNameHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view view) const { return std::hash<std::string_view>()(view); }
+        size_t operator()(const CountedName &name) const { return (*this)(std::string_view(name.text)); }
+    };
+
+    struct CollidingNameHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view) const { return 0; }
+        size_t operator()(const CountedName &) const { return 0; }
+    };
+
+    struct TransparentTreeifyPolicy : userDefineDataStructure::HashMapPolicy {
+        static constexpr size_t treeify_threshold = 4;
+    };
+
+    template<typename Map>
+    void expect_lookups_without_conversion(Map &names) {
+        for (int i = 0; i < 100; ++i)
+            names.insert_or_assign(CountedName("name" + std::to_string(i)), i);
+        CountedName::conversions = 0;
+
+        std::string buffer = "name42;name7;missing";
+        std::string_view name42 = std::string_view(buffer).substr(0, 6);
+        EXPECT_TRUE(names.contains(name42));
+        EXPECT_EQ(names.at(name42), 42);
+        EXPECT_EQ(names.find(std::string_view("name7"))->second, 7);
+        EXPECT_EQ(names.find(std::string_view("missing")), names.end());
+        EXPECT_THROW(names.at(std::string_view("missing")), std::out_of_range);
+        EXPECT_TRUE(names.erase(name42));
+        EXPECT_FALSE(names.contains(name42));
+        EXPECT_EQ(names.size(), 99);
+        EXPECT_EQ(CountedName::conversions, 0);
+    }
+
+    TEST_F(HashMapTest, HeterogeneousLookup) {
+        userDefineDataStructure::HashMap<CountedName, int, CountedNameHash> names;
+        expect_lookups_without_conversion(names);
+
+        // Every key collides, so lookups go through the bucket's tree index.
+        userDefineDataStructure::HashMap<CountedName, int, CollidingNameHash, TransparentTreeifyPolicy> treeified;
+        expect_lookups_without_conversion(treeified);
+    }
+
+    TEST_F(HashMapTest, StringViewLookupPerformance) {
+        const int NUM_KEYS = 10000;
+        const int ROUNDS = 20;
+        using Map = userDefineDataStructure::HashMap<std::string, int, userDefineDataStructure::FastHash<std::string>>;
+        Map sessions;
+        std::string buffer;
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            std::string key = "session-token-" + std::to_string(i) + "-with-a-long-enough-suffix";
+            sessions.insert_or_assign(key, i);
+            buffer += key + ";";
+        }
+        std::vector<std::string_view> views;
+        for (size_t start = 0, end; (end = buffer.find(';', start)) != std::string::npos; start = end + 1)
+            views.push_back(std::string_view(buffer).substr(start, end - start));
+
+        auto run = [&](auto &&lookup) {
+            size_t found = 0;
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int round = 0; round < ROUNDS; ++round)
+                for (auto view: views)
+                    found += lookup(view);
+            auto end = std::chrono::high_resolution_clock::now();
+            EXPECT_EQ(found, static_cast<size_t>(NUM_KEYS) * ROUNDS);
+            return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+        };
+        auto temporary_ms = run([&](std::string_view view) { return sessions.contains(std::string(view)); });
+        auto view_ms = run([&](std::string_view view) { return sessions.contains(view); });
+        std::cout << "Lookups through a temporary std::string: " << temporary_ms << "ms" << std::endl;
+        std::cout << "Lookups by std::string_view:             " << view_ms << "ms" << std::endl;
+    }
+
+    TEST_F(HashMapTest, ConstIteration) {
+        for (int i = 0; i < 100; ++i)
+            map.insert_or_assign("key" + std::to_string(i), i);
+        const auto &view = map;
+
+        int sum = 0, count = 0;
+        for (const auto &pair: view) {
+            sum += pair.second;
+            ++count;
+        }
+        EXPECT_EQ(count, 100);
+        EXPECT_EQ(sum, 99 * 100 / 2);
+
+        auto it = view.find("key42");
+        ASSERT_NE(it, view.end());
+        EXPECT_EQ(it->second, 42);
+        EXPECT_EQ(view.find("missing"), view.cend());
+
+        userDefineDataStructure::HashMap<std::string, int>::const_iterator converted = map.begin();
+        EXPECT_EQ(converted, map.cbegin());
+    }
+
+    TEST_F(HashMapTest, ParallelForEachAndReduce) {
+        const int NUM_KEYS = 100000;
+        userDefineDataStructure::HashMap<int, long> values(8);
+        values.incremental_rehash(4);
+        for (int i = 0; i < NUM_KEYS; ++i)
+            values.insert_or_assign(i, i);
+        EXPECT_TRUE(values.rehash_in_progress());
+
+        values.parallel_for_each([](auto &pair) { pair.second *= 2; }, 4);
+        long serial = 0;
+        for (auto &pair: values)
+            serial += pair.second;
+        EXPECT_EQ(serial, static_cast<long>(NUM_KEYS) * (NUM_KEYS - 1));
+
+        const auto &view = values;
+        auto sum = [](const auto &pair) { return pair.second; };
+        EXPECT_EQ(view.parallel_reduce(0L, sum, std::plus<>(), 4), serial);
+        EXPECT_EQ(view.parallel_reduce(5L, sum, std::plus<>(), 1), serial + 5);
+        auto max = view.parallel_reduce(-1L, sum, [](long a, long b) { return std::max(a, b); });
+        EXPECT_EQ(max, 2L * (NUM_KEYS - 1));
+
+        std::atomic<int> visited{0};
+        view.parallel_for_each([&](const auto &) { ++visited; });
+        EXPECT_EQ(visited.load(), NUM_KEYS);
+
+        EXPECT_THROW(view.parallel_for_each([](const auto &pair) {
+            if (pair.first == 777)
+                throw std::runtime_error("boom");
+        }, 4),
+                     std::runtime_error);
+
+        userDefineDataStructure::HashMap<int, long> empty;
+        EXPECT_EQ(empty.parallel_reduce(7L, sum, std::plus<>()), 7);
+    }
+
+    TEST_F(HashMapTest, ParallelScanPerformance) {
+        const int NUM_KEYS = 2000000;
+        userDefineDataStructure::HashMap<int, long> values;
+        values.reserve(NUM_KEYS);
+        for (int i = 0; i < NUM_KEYS; ++i)
+            values.insert_or_assign(i, i);
+
+        auto start = std::chrono::high_resolution_clock::now();
+        long serial = 0;
+        for (const auto &pair: std::as_const(values))
+            serial += pair.second;
+        auto middle = std::chrono::high_resolution_clock::now();
+        long parallel = std::as_const(values).parallel_reduce(0L, [](const auto &pair) { return pair.second; }, std::plus<>());
+        auto end = std::chrono::high_resolution_clock::now();
+
+        EXPECT_EQ(parallel, serial);
+        std::cout << "Iterator scan of " << NUM_KEYS << " entries: " << std::chrono::duration_cast<std::chrono::milliseconds>(middle - start).count() << "ms" << std::endl;
+        std::cout << "parallel_reduce on " << std::thread::hardware_concurrency() << " threads: " << std::chrono::duration_cast<std::chrono::milliseconds>(end - middle).count() << "ms" << std::endl;
+    }
+
+    struct PooledPolicy : userDefineDataStructure::HashMapPolicy {
+        using node_allocator = userDefineDataStructure::PoolNodeAllocator;
+    };
+
+    struct PooledTreeifyPolicy : PooledPolicy {
+        static constexpr size_t treeify_threshold = 8;
+    };
+
+    TEST_F(HashMapTest, PooledNodes) {
+        userDefineDataStructure::HashMap<std::string, int, std::hash<std::string>, PooledPolicy> pooled(4);
+        pooled.incremental_rehash(2);
+        for (int i = 0; i < 10000; ++i)
+            pooled.insert_or_assign("key" + std::to_string(i), i);
+        EXPECT_EQ(pooled.node_pool().live_nodes(), 10000);
+        size_t reserved = pooled.node_pool().bytes_reserved();
+
+        for (int i = 0; i < 10000; i += 2)
+            EXPECT_TRUE(pooled.erase("key" + std::to_string(i)));
+        for (int i = 0; i < 5000; ++i)
+            pooled.insert_or_assign("new" + std::to_string(i), i);
+        EXPECT_EQ(pooled.node_pool().bytes_reserved(), reserved);
+
+        auto copy = pooled;
+        EXPECT_NE(&copy.node_pool(), &pooled.node_pool());
+        EXPECT_EQ(copy.node_pool().live_nodes(), 10000);
+        EXPECT_EQ(copy.at("key1"), 1);
+        pooled.clear();
+        EXPECT_EQ(pooled.node_pool().bytes_reserved(), 0);
+        EXPECT_EQ(copy.at("new42"), 42);
+
+        auto moved = std::move(copy);
+        EXPECT_EQ(moved.size(), 10000);
+        pooled = std::move(moved);
+        EXPECT_EQ(pooled.at("key9999"), 9999);
+        pooled.insert_or_assign("after move", 1);
+        EXPECT_EQ(pooled.size(), 10001);
+
+        auto [emplaced, inserted] = pooled.emplace("emplaced", 7);
+        EXPECT_TRUE(inserted);
+        EXPECT_EQ(emplaced->second, 7);
+        EXPECT_FALSE(pooled.emplace("emplaced", 8).second);
+        EXPECT_EQ(pooled.at("emplaced"), 7);
+        EXPECT_EQ(pooled.node_pool().live_nodes(), pooled.size());
+
+        userDefineDataStructure::HashMap<int, int, ConstantHash, PooledTreeifyPolicy> treeified;
+        for (int i = 0; i < 100; ++i)
+            treeified.insert_or_assign(i, i);
+        EXPECT_TRUE(treeified.emplace(100, 100).second);
+        EXPECT_FALSE(treeified.emplace(50, -1).second);
+        EXPECT_EQ(treeified.at(50), 50);
+        treeified.erase(100);
+        auto treeified_copy = treeified;
+        for (int i = 0; i < 100; ++i)
+            EXPECT_EQ(treeified_copy.at(i), i);
+
+        // Copy-assigned maps keep allocating from their own pool after the source is gone.
+        userDefineDataStructure::HashMap<int, int, ConstantHash, PooledTreeifyPolicy> assigned;
+        {
+            userDefineDataStructure::HashMap<int, int, ConstantHash, PooledTreeifyPolicy> source = treeified;
+            assigned = source;
+        }
+        for (int i = 100; i < 200; ++i)
+            assigned.insert_or_assign(i, i);
+        EXPECT_EQ(assigned.node_pool().live_nodes(), 200);
+        EXPECT_EQ(assigned.at(150), 150);
+    }
+
+    TEST_F(HashMapTest, PooledNodesPerformance) {
+        const int NUM_KEYS = 1000000;
+        auto run = [&](auto &map) {
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < NUM_KEYS; ++i)
+                map.insert_or_assign(i, i);
+            auto middle = std::chrono::high_resolution_clock::now();
+            map.clear();
+            auto end = std::chrono::high_resolution_clock::now();
+            return std::make_pair(std::chrono::duration_cast<std::chrono::milliseconds>(middle - start).count(),
+                                  std::chrono::duration_cast<std::chrono::milliseconds>(end - middle).count());
+        };
+
+        userDefineDataStructure::HashMap<int, int> heap;
+        userDefineDataStructure::HashMap<int, int, std::hash<int>, PooledPolicy> pooled;
+        heap.reserve(NUM_KEYS);
+        pooled.reserve(NUM_KEYS);
+        auto [heap_insert, heap_clear] = run(heap);
+        for (int i = 0; i < NUM_KEYS; ++i)
+            pooled.insert_or_assign(i, i);
+        size_t pool_bytes = pooled.node_pool().bytes_reserved();
+        pooled.clear();
+        auto [pool_insert, pool_clear] = run(pooled);
+
+        std::cout << NUM_KEYS << " inserts, heap nodes: " << heap_insert << "ms (clear " << heap_clear << "ms)" << std::endl;
+        std::cout << NUM_KEYS << " inserts, pooled nodes: " << pool_insert << "ms (clear " << pool_clear << "ms), "
+                  << pool_bytes / NUM_KEYS << " bytes per node in slabs" << std::endl;
+    }
+
     struct ComplexKey {
         int a;
         std::string b;
@@ -0,0 +1,148 @@
+#include "hash.h"
+#include "hash_table.h"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+
+    using userDefineDataStructure::FastHash;
+
+    TEST(FastHashTest, StringTypesHashEqually) {
+        std::string text = "the quick brown fox";
+        std::string_view view = text;
+        size_t expected = userDefineDataStructure::hash_bytes(text.data(), text.size());
+        EXPECT_EQ(FastHash<std::string>{}(text), expected);
+        EXPECT_EQ(FastHash<std::string_view>{}(view), expected);
+        EXPECT_EQ(FastHash<std::string>{}("the quick brown fox"), expected);
+        EXPECT_NE(userDefineDataStructure::hash_bytes(text.data(), text.size(), 1), expected);
+    }
+
+    TEST(FastHashTest, EveryLengthAndPrefixDiffers) {
+        // Covers the 0-3, 4-16, 17-48 and >48 byte paths.
+        std::string text(300, 'a');
+        std::set<size_t> seen;
+        for (size_t length = 0; length <= text.size(); ++length)
+            seen.insert(FastHash<std::string_view>{}(std::string_view(text.data(), length)));
+        EXPECT_EQ(seen.size(), text.size() + 1);
+
+        for (size_t position = 0; position < 100; ++position) {
+            std::string flipped(100, 'a');
+            flipped[position] = 'b';
+            EXPECT_NE(FastHash<std::string>{}(flipped), FastHash<std::string>{}(std::string(100, 'a')));
+        }
+    }
+
+    TEST(FastHashTest, IntegerAvalanche) {
+        // Flipping one input bit should flip about half of the output bits.
+        FastHash<uint64_t> hash;
+        double total = 0;
+        int trials = 0;
+        for (uint64_t key = 0; key < 1000; ++key) {
+            uint64_t base = key * 0x9E3779B97F4A7C15ull;
+            for (int bit = 0; bit < 64; ++bit, ++trials)
+                total += std::popcount(static_cast<uint64_t>(hash(base) ^ hash(base ^ (1ull << bit))));
+        }
+        double average = total / trials;
+        EXPECT_GT(average, 28.0);
+        EXPECT_LT(average, 36.0);
+    }
+
+    TEST(FastHashTest, FloatingPointZeros) {
+        EXPECT_EQ(FastHash<double>{}(0.0), FastHash<double>{}(-0.0));
+        EXPECT_NE(FastHash<double>{}(1.0), FastHash<double>{}(-1.0));
+    }
+
+    TEST(FastHashTest, UsableAsHashMapHash) {
+        userDefineDataStructure::HashMap<std::string, int, FastHash<std::string>> words;
+        userDefineDataStructure::HashMap<int, int, FastHash<int>> numbers;
+        for (int i = 0; i < 1000; ++i) {
+            words.insert_or_assign("word" + std::to_string(i), i);
+            numbers.insert_or_assign(i, i);
+        }
+        for (int i = 0; i < 1000; ++i) {
+            EXPECT_EQ(words.at("word" + std::to_string(i)), i);
+            EXPECT_EQ(numbers.at(i), i);
+        }
+    }
+
+    TEST(FastHashTest, DistributionAgainstStdHash) {
+        // Strided integer keys, bucketed by the low bits of the hash as a
+        // power-of-two table without extra mixing would.
+        const size_t BUCKETS = 1024;
+        const size_t NUM_KEYS = 100000;
+        auto max_load = [&](auto &&hash, auto &&key_of) {
+            std::vector<size_t> load(BUCKETS);
+            for (size_t i = 0; i < NUM_KEYS; ++i)
+                ++load[hash(key_of(i)) & (BUCKETS - 1)];
+            return *std::max_element(load.begin(), load.end());
+        };
+
+        auto strided = [](size_t i) { return static_cast<uint64_t>(i) << 12; };
+        auto std_int = max_load(std::hash<uint64_t>{}, strided);
+        auto fast_int = max_load(FastHash<uint64_t>{}, strided);
+
+        auto numbered = [](size_t i) { return "user:" + std::to_string(i); };
+        auto std_str = max_load(std::hash<std::string>{}, numbered);
+        auto fast_str = max_load(FastHash<std::string>{}, numbered);
+
+        std::cout << "Max bucket load, " << NUM_KEYS << " keys in " << BUCKETS << " buckets (ideal "
+                  << NUM_KEYS / BUCKETS << "):" << std::endl;
+        std::cout << "  strided integers: std::hash " << std_int << ", FastHash " << fast_int << std::endl;
+        std::cout << "  numbered strings: std::hash " << std_str << ", FastHash " << fast_str << std::endl;
+        EXPECT_LT(fast_int, 2 * NUM_KEYS / BUCKETS);
+        EXPECT_LT(fast_str, 2 * NUM_KEYS / BUCKETS);
+    }
+
+    TEST(FastHashTest, ThroughputAgainstStdHash) {
+        const size_t NUM_KEYS = 1 << 16;
+        const int ROUNDS = 20;
+        for (size_t length: {8, 32, 256}) {
+            std::vector<std::string> keys;
+            for (size_t i = 0; i < NUM_KEYS; ++i) {
+                std::string key = std::to_string(i);
+                key.resize(length, static_cast<char>('a' + i % 26));
+                keys.push_back(key);
+            }
+
+            auto run = [&](auto &&hash) {
+                size_t sink = 0;
+                auto start = std::chrono::high_resolution_clock::now();
+                for (int round = 0; round < ROUNDS; ++round)
+                    for (const auto &key: keys)
+                        sink += hash(key);
+                auto end = std::chrono::high_resolution_clock::now();
+                EXPECT_NE(sink, 1);// keep the loop alive
+                return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+            };
+
+            auto std_us = run(std::hash<std::string>{});
+            auto fast_us = run(FastHash<std::string>{});
+            std::cout << NUM_KEYS * ROUNDS << " hashes of " << length << "-byte strings: std::hash " << std_us
+                      << "us, FastHash " << fast_us << "us" << std::endl;
+        }
+
+        auto map_run = [&](auto &map) {
+            auto start = std::chrono::high_resolution_clock::now();
+            for (size_t i = 0; i < NUM_KEYS; ++i)
+                map.insert_or_assign("session:" + std::to_string(i), static_cast<int>(i));
+            size_t found = 0;
+            for (size_t i = 0; i < NUM_KEYS; ++i)
+                found += map.contains("session:" + std::to_string(i));
+            auto end = std::chrono::high_resolution_clock::now();
+            EXPECT_EQ(found, NUM_KEYS);
+            return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+        };
+        userDefineDataStructure::HashMap<std::string, int> std_map;
+        userDefineDataStructure::HashMap<std::string, int, FastHash<std::string>> fast_map;
+        auto std_ms = map_run(std_map);
+        auto fast_ms = map_run(fast_map);
+        std::cout << "HashMap<string>, " << NUM_KEYS << " inserts + lookups: std::hash " << std_ms
+                  << "ms, FastHash " << fast_ms << "ms" << std::endl;
+    }
+
+}// namespace
@@ -0,0 +1,135 @@
+#include "lru_cache.h"
+#include <algorithm>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+    class LRUCacheTest : public ::testing::Test {
+    protected:
+        userDefineDataStructure::LRUCache<int, std::string> cache{3};
+    };
+
+    TEST_F(LRUCacheTest, GetAndPut) {
+        EXPECT_EQ(cache.get(1), nullptr);
+        cache.put(1, "one");
+        ASSERT_NE(cache.get(1), nullptr);
+        EXPECT_EQ(*cache.get(1), "one");
+
+        cache.put(1, "uno");
+        EXPECT_EQ(*cache.get(1), "uno");
+        EXPECT_EQ(cache.size(), 1);
+        EXPECT_EQ(cache.hits(), 3);
+        EXPECT_EQ(cache.misses(), 1);
+    }
+
+    TEST_F(LRUCacheTest, EvictsLeastRecentlyUsed) {
+        std::vector<int> evicted;
+        cache.set_eviction_callback([&](const int &key, std::string &) { evicted.push_back(key); });
+        cache.put(1, "one");
+        cache.put(2, "two");
+        cache.put(3, "three");
+        cache.get(1);
+        cache.put(4, "four");
+
+        EXPECT_EQ(evicted, std::vector<int>{2});
+        EXPECT_FALSE(cache.contains(2));
+        EXPECT_TRUE(cache.contains(1));
+
+        cache.put(3, "THREE");
+        cache.put(5, "five");
+        EXPECT_EQ(evicted, (std::vector<int>{2, 1}));
+        EXPECT_EQ(cache.evictions(), 2);
+        EXPECT_EQ(cache.size(), 3);
+    }
+
+    TEST_F(LRUCacheTest, ByteBudget) {
+        userDefineDataStructure::LRUCache<std::string, std::string> sized(100, 10);
+        sized.put("a", "aaaa", 4);
+        sized.put("b", "bbbb", 4);
+        EXPECT_EQ(sized.bytes(), 8);
+        sized.put("c", "cccc", 4);
+        EXPECT_FALSE(sized.contains("a"));
+        EXPECT_EQ(sized.bytes(), 8);
+
+        sized.put("b", "bb", 2);
+        EXPECT_EQ(sized.bytes(), 6);
+        sized.put("huge", std::string(20, 'x'), 20);
+        EXPECT_FALSE(sized.contains("huge"));
+        EXPECT_EQ(sized.size(), 0);
+        EXPECT_EQ(sized.bytes(), 0);
+
+        sized.put("d", "dd", 2);
+        sized.put("e", "ee", 2);
+        sized.resize(1);
+        EXPECT_TRUE(sized.contains("e"));
+        EXPECT_EQ(sized.size(), 1);
+        EXPECT_THROW(sized.resize(0), std::invalid_argument);
+    }
+
+    TEST_F(LRUCacheTest, EraseAndClear) {
+        cache.put(1, "one");
+        cache.put(2, "two");
+        EXPECT_TRUE(cache.erase(1));
+        EXPECT_FALSE(cache.erase(1));
+        EXPECT_EQ(cache.size(), 1);
+        cache.clear();
+        EXPECT_TRUE(cache.empty());
+        EXPECT_EQ(cache.get(2), nullptr);
+        EXPECT_EQ(cache.evictions(), 0);
+    }
+
+    TEST_F(LRUCacheTest, MatchesReferenceModel) {
+        const size_t CAPACITY = 64;
+        userDefineDataStructure::LRUCache<int, int> lru(CAPACITY);
+        std::vector<int> order;// most recent first
+        std::mt19937 gen(5);
+        for (int i = 0; i < 20000; ++i) {
+            int key = static_cast<int>(gen() % 200);
+            auto pos = std::find(order.begin(), order.end(), key);
+            if (gen() % 2) {
+                int *value = lru.get(key);
+                EXPECT_EQ(value != nullptr, pos != order.end());
+                if (value) {
+                    EXPECT_EQ(*value, key * 2);
+                    order.erase(pos);
+                    order.insert(order.begin(), key);
+                }
+            } else {
+                lru.put(key, key * 2);
+                if (pos != order.end())
+                    order.erase(pos);
+                order.insert(order.begin(), key);
+                if (order.size() > CAPACITY)
+                    order.pop_back();
+            }
+        }
+        EXPECT_EQ(lru.size(), order.size());
+        for (int key: order)
+            EXPECT_TRUE(lru.contains(key));
+    }
+
+    TEST_F(LRUCacheTest, PerformanceTest) {
+        const int NUM_OPERATIONS = 1000000;
+        userDefineDataStructure::LRUCache<int, int> lru(10000);
+        std::mt19937 gen(9);
+        std::uniform_int_distribution<> dis(0, 20000);
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < NUM_OPERATIONS; ++i) {
+            int key = dis(gen);
+            if (!lru.get(key))
+                lru.put(key, i);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+        std::cout << NUM_OPERATIONS << " get/put operations: " << duration.count() << "ms, hit rate "
+                  << lru.hit_rate() << std::endl;
+        EXPECT_EQ(lru.size(), 10000);
+        EXPECT_LT(duration.count(), 10000);
+    }
+
+}// namespace
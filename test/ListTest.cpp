@@ -1,5 +1,7 @@
 #include "list.h"
+#include "node_pool.h"
 #include <gtest/gtest.h>
+#include <string>
 
 TEST(ListTest, PushBack) {
     userDefineDataStructure::List<int> list;
@@ -152,3 +154,155 @@ TEST(ListTest, ConstIterator) {
     ++it;
     EXPECT_EQ(it, list.cend());
 }
+
+TEST(ListTest, SpliceElement) {
+    userDefineDataStructure::List<int> list = {1, 2, 3};
+    userDefineDataStructure::List<int> other = {10, 20};
+
+    const int *address = &other.front();
+    list.splice(list.begin(), other, other.begin());
+    EXPECT_EQ(list.size(), 4);
+    EXPECT_EQ(other.size(), 1);
+    EXPECT_EQ(list.front(), 10);
+    EXPECT_EQ(&list.front(), address);
+
+    list.splice(list.end(), other, other.begin());
+    EXPECT_EQ(list.back(), 20);
+    EXPECT_TRUE(other.empty());
+
+    auto last = list.begin();
+    while (*last != 20)
+        ++last;
+    list.splice(list.begin(), list, last);
+    int expected[] = {20, 10, 1, 2, 3};
+    int i = 0;
+    for (int value: list)
+        EXPECT_EQ(value, expected[i++]);
+    EXPECT_EQ(list.back(), 3);
+}
+
+TEST(ListTest, SpliceList) {
+    userDefineDataStructure::List<int> list = {1, 4};
+    userDefineDataStructure::List<int> other = {2, 3};
+
+    list.splice(++list.begin(), other);
+    EXPECT_EQ(list.size(), 4);
+    EXPECT_TRUE(other.empty());
+    int expected = 1;
+    for (int value: list)
+        EXPECT_EQ(value, expected++);
+
+    userDefineDataStructure::List<int> empty;
+    empty.splice(empty.end(), list);
+    EXPECT_EQ(empty.size(), 4);
+    EXPECT_EQ(empty.front(), 1);
+    EXPECT_EQ(empty.back(), 4);
+    empty.pop_back();
+    EXPECT_EQ(empty.back(), 3);
+}
+
+TEST(ListTest, EmplaceConstructsInPlace) {
+    userDefineDataStructure::List<std::pair<int, std::string>> list;
+    auto &first = list.emplace_back(1, "one");
+    EXPECT_EQ(first.second, "one");
+
+    std::pair<int, std::string> moved(3, "three");
+    list.push_back(std::move(moved));
+    auto it = list.emplace(++list.begin(), 2, "two");
+    EXPECT_EQ(it->first, 2);
+
+    int expected = 1;
+    for (const auto &item: list)
+        EXPECT_EQ(item.first, expected++);
+    EXPECT_EQ(list.size(), 3);
+    EXPECT_EQ(list.back().second, "three");
+}
+
+TEST(ListTest, EraseAtPosition) {
+    userDefineDataStructure::List<int> list = {1, 2, 3, 4};
+    auto it = list.erase(list.begin());
+    EXPECT_EQ(*it, 2);
+    EXPECT_EQ(list.front(), 2);
+
+    ++it;
+    it = list.erase(it);
+    EXPECT_EQ(*it, 4);
+    it = list.erase(it);
+    EXPECT_EQ(it, list.end());
+    EXPECT_EQ(list.back(), 2);
+    EXPECT_EQ(list.size(), 1);
+
+    list.push_back(5);
+    EXPECT_EQ(list.back(), 5);
+    list.erase(list.begin());
+    list.erase(list.begin());
+    EXPECT_TRUE(list.empty());
+}
+
+TEST(ListTest, ClearLongList) {
+    userDefineDataStructure::List<int> list;
+    for (int i = 0; i < 1000000; ++i)
+        list.push_back(i);
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    for (int i = 0; i < 1000000; ++i)
+        list.push_front(i);
+}
+
+TEST(ListTest, PooledNodes) {
+    userDefineDataStructure::NodePool pool;
+    userDefineDataStructure::PoolNodeAllocator alloc(&pool);
+    using PooledList = userDefineDataStructure::List<std::string, userDefineDataStructure::PoolNodeAllocator>;
+    PooledList first(alloc), second(alloc);
+
+    for (int i = 0; i < 10000; ++i)
+        first.push_back("value " + std::to_string(i));
+    EXPECT_EQ(pool.live_nodes(), 10000);
+    size_t reserved = pool.bytes_reserved();
+    EXPECT_GT(reserved, 0);
+
+    second.splice(second.end(), first, first.begin());
+    second.splice(second.end(), first);
+    EXPECT_TRUE(first.empty());
+    EXPECT_EQ(second.size(), 10000);
+    EXPECT_EQ(second.front(), "value 0");
+
+    PooledList copy(second);
+    EXPECT_EQ(copy.size(), 10000);
+    EXPECT_EQ(pool.live_nodes(), 20000);
+    copy.clear();
+    reserved = pool.bytes_reserved();
+
+    // Erased nodes are reused before the pool grows.
+    for (int i = 0; i < 5000; ++i)
+        second.pop_front();
+    for (int i = 0; i < 5000; ++i)
+        second.emplace_back("again");
+    EXPECT_EQ(pool.bytes_reserved(), reserved);
+    EXPECT_FALSE(pool.release());
+
+    second.clear();
+    EXPECT_TRUE(pool.release());
+    EXPECT_EQ(pool.bytes_reserved(), 0);
+}
+
+TEST(ListTest, PooledCopyAssignKeepsOwnPool) {
+    using PooledList = userDefineDataStructure::List<std::string, userDefineDataStructure::PoolNodeAllocator>;
+    userDefineDataStructure::NodePool long_lived;
+    PooledList target{userDefineDataStructure::PoolNodeAllocator(&long_lived)};
+    target.push_back("old");
+    {
+        userDefineDataStructure::NodePool short_lived;
+        PooledList source{userDefineDataStructure::PoolNodeAllocator(&short_lived)};
+        source.push_back("a");
+        source.push_back("b");
+        target = source;
+        EXPECT_EQ(target.get_allocator().pool, &long_lived);
+        EXPECT_EQ(long_lived.live_nodes(), 2);
+        EXPECT_EQ(short_lived.live_nodes(), 2);
+    }
+    target.push_back("c");
+    EXPECT_EQ(target.size(), 3);
+    EXPECT_EQ(target.back(), "c");
+    EXPECT_EQ(long_lived.live_nodes(), 3);
+}
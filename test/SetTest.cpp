@@ -1,6 +1,8 @@
 #include "set.h"
 #include <algorithm>
 #include <gtest/gtest.h>
+#include <random>
+#include <set>
 #include <vector>
 
 class SetTest : public ::testing::Test {
@@ -169,3 +171,28 @@ TEST_F(SetTest, CustomComparator) {
     std::vector<int> expected = {3, 2, 1};
     EXPECT_EQ(values, expected);
 }
+
+TEST_F(SetTest, RandomEraseAgainstStdSet) {
+    std::mt19937 gen(1);
+    std::set<int> reference;
+    for (int i = 0; i < 20000; ++i) {
+        int key = static_cast<int>(gen() % 500);
+        if (gen() % 3 == 0) {
+            EXPECT_EQ(intSet.erase(key), reference.erase(key));
+        } else {
+            intSet.insert(key);
+            reference.insert(key);
+        }
+    }
+    EXPECT_EQ(intSet.size(), reference.size());
+    std::vector<int> values(intSet.begin(), intSet.end());
+    EXPECT_EQ(values, std::vector<int>(reference.begin(), reference.end()));
+}
+
+TEST_F(SetTest, TransparentFind) {
+    userDefineDataStructure::set<std::string, std::less<>> names;
+    names.insert("alice");
+    names.insert("bob");
+    EXPECT_NE(names.find("bob"), names.end());
+    EXPECT_EQ(names.find(std::string_view("carol")), names.end());
+}
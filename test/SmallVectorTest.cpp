@@ -0,0 +1,199 @@
+#include "small_vector.h"
+#include "vector.h"
+#include <chrono>
+#include <gtest/gtest.h>
+#include <list>
+#include <memory>
+#include <memory_resource>
+#include <string>
+
+namespace {
+
+    template<typename T>
+    struct CountingAllocator {
+        using value_type = T;
+        static inline int allocations = 0;
+
+        CountingAllocator() = default;
+        template<typename U>
+        CountingAllocator(const CountingAllocator<U> &) {}
+
+        T *allocate(size_t n) {
+            ++allocations;
+            return std::allocator<T>().allocate(n);
+        }
+        void deallocate(T *p, size_t n) { std::allocator<T>().deallocate(p, n); }
+        bool operator==(const CountingAllocator &) const = default;
+    };
+
+    using userDefineDataStructure::small_vector;
+
+    TEST(SmallVectorTest, StaysInlineUpToN) {
+        CountingAllocator<int>::allocations = 0;
+        small_vector<int, 8, CountingAllocator<int>> vec;
+        EXPECT_TRUE(vec.empty());
+        EXPECT_EQ(vec.capacity(), 8);
+        for (int i = 0; i < 8; ++i)
+            vec.push_back(i);
+        EXPECT_TRUE(vec.is_inline());
+        EXPECT_EQ(CountingAllocator<int>::allocations, 0);
+
+        vec.push_back(8);
+        EXPECT_FALSE(vec.is_inline());
+        EXPECT_EQ(CountingAllocator<int>::allocations, 1);
+        EXPECT_GT(vec.capacity(), 8);
+        for (int i = 0; i < 9; ++i)
+            EXPECT_EQ(vec[i], i);
+
+        vec.clear();
+        EXPECT_FALSE(vec.is_inline());
+        for (int i = 0; i < 1000; ++i)
+            vec.push_back(i);
+        EXPECT_EQ(vec.at(999), 999);
+        EXPECT_THROW(vec.at(1000), std::out_of_range);
+    }
+
+    TEST(SmallVectorTest, VectorOperations) {
+        small_vector<std::string, 4> words = {"a", "b", "c"};
+        EXPECT_TRUE(words.is_inline());
+        std::list<std::string> more = {"x", "y", "z"};
+        words.insert(words.begin() + 1, more.begin(), more.end());
+        EXPECT_FALSE(words.is_inline());
+        ASSERT_EQ(words.size(), 6);
+        EXPECT_EQ(words[1], "x");
+        EXPECT_EQ(words.back(), "c");
+
+        words.erase(words.begin() + 1, words.begin() + 4);
+        EXPECT_EQ(words.size(), 3);
+        EXPECT_EQ(words[1], "b");
+        words.emplace_back(10, 'q');
+        EXPECT_EQ(words.back(), std::string(10, 'q'));
+        words.pop_back();
+        words.append_range(more);
+        EXPECT_EQ(words.size(), 6);
+        words.resize(2);
+        EXPECT_EQ(words.front(), "a");
+
+        small_vector<int, 4> filled(3, 7);
+        EXPECT_EQ(filled[2], 7);
+        small_vector<int, 4> sized(10);
+        EXPECT_EQ(sized.size(), 10);
+        EXPECT_EQ(sized[9], 0);
+        small_vector<int, 4> ranged(more.size(), 1);
+        ranged.assign({4, 5});
+        EXPECT_EQ(ranged.size(), 2);
+    }
+
+    TEST(SmallVectorTest, CopyAndMove) {
+        small_vector<std::string, 2> inline_vec = {"one", "two"};
+        small_vector<std::string, 2> spilled = {"a", "b", "c", "d"};
+
+        auto inline_copy = inline_vec;
+        auto spilled_copy = spilled;
+        EXPECT_TRUE(inline_copy.is_inline());
+        EXPECT_FALSE(spilled_copy.is_inline());
+        EXPECT_EQ(spilled_copy[3], "d");
+
+        auto moved_inline = std::move(inline_copy);
+        EXPECT_TRUE(moved_inline.is_inline());
+        EXPECT_EQ(moved_inline[1], "two");
+        EXPECT_TRUE(inline_copy.empty());
+
+        const std::string *storage = spilled_copy.data();
+        auto moved_spilled = std::move(spilled_copy);
+        EXPECT_EQ(moved_spilled.data(), storage);
+        EXPECT_TRUE(spilled_copy.empty());
+        EXPECT_TRUE(spilled_copy.is_inline());
+        spilled_copy.push_back("reused");
+        EXPECT_EQ(spilled_copy[0], "reused");
+
+        // Spilled into inline, inline into spilled, and self-assignment.
+        moved_inline = std::move(moved_spilled);
+        EXPECT_EQ(moved_inline.data(), storage);
+        EXPECT_EQ(moved_inline.size(), 4);
+        moved_inline = inline_vec;
+        EXPECT_EQ(moved_inline.size(), 2);
+        moved_spilled = std::move(moved_inline);
+        EXPECT_EQ(moved_spilled[0], "one");
+        auto &self = moved_spilled;
+        moved_spilled = std::move(self);
+        EXPECT_EQ(moved_spilled.size(), 2);
+    }
+
+    TEST(SmallVectorTest, Swap) {
+        small_vector<std::string, 3> a = {"a"};
+        small_vector<std::string, 3> b = {"1", "2", "3", "4", "5"};
+        small_vector<std::string, 3> c = {"x", "y", "z", "w"};
+
+        swap(a, b);
+        EXPECT_EQ(a.size(), 5);
+        EXPECT_EQ(b.size(), 1);
+        EXPECT_EQ(b[0], "a");
+        EXPECT_TRUE(b.is_inline());
+
+        const std::string *a_storage = a.data(), *c_storage = c.data();
+        a.swap(c);
+        EXPECT_EQ(a.data(), c_storage);
+        EXPECT_EQ(c.data(), a_storage);
+        EXPECT_EQ(a[3], "w");
+        EXPECT_EQ(c[4], "5");
+    }
+
+    TEST(SmallVectorTest, ForwardsAllocatorConstruction) {
+        // polymorphic_allocator passes its resource on to each element it constructs.
+        std::pmr::monotonic_buffer_resource resource;
+        using Allocator = std::pmr::polymorphic_allocator<std::pmr::string>;
+        auto uses_resource = [&](const auto &vec) {
+            for (const auto &value: vec)
+                if (value.get_allocator().resource() != &resource)
+                    return false;
+            return true;
+        };
+        const std::string long_text(64, 'x');
+
+        small_vector<std::pmr::string, 2, Allocator> strings{Allocator(&resource)};
+        strings.emplace_back(long_text);
+        strings.push_back(std::pmr::string("inline"));
+        EXPECT_TRUE(strings.is_inline());
+        EXPECT_TRUE(uses_resource(strings));
+
+        std::vector<std::pmr::string> more(5, std::pmr::string(long_text));
+        strings.insert(strings.begin() + 1, more.begin(), more.end());
+        strings.resize(10);
+        strings.append_range(more);
+        EXPECT_FALSE(strings.is_inline());
+        EXPECT_EQ(strings.size(), 15);
+        EXPECT_TRUE(uses_resource(strings));
+        strings.assign(3, std::pmr::string(long_text));
+        EXPECT_TRUE(uses_resource(strings));
+
+        userDefineDataStructure::vector<std::pmr::string, Allocator> plain{Allocator(&resource)};
+        plain.assign(more.begin(), more.end());
+        plain.resize(20, std::pmr::string(long_text));
+        EXPECT_TRUE(uses_resource(plain));
+    }
+
+    TEST(SmallVectorTest, ShortLivedVectorPerformance) {
+        const int ITERATIONS = 2000000;
+        auto run = [&](auto tag) {
+            using Vector = decltype(tag);
+            long sum = 0;
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < ITERATIONS; ++i) {
+                Vector vec;
+                for (int j = 0; j < 6; ++j)
+                    vec.push_back(i + j);
+                sum += vec.back();
+            }
+            auto end = std::chrono::high_resolution_clock::now();
+            EXPECT_GT(sum, 0);
+            return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+        };
+
+        auto vector_ms = run(userDefineDataStructure::vector<int>());
+        auto small_ms = run(small_vector<int, 8>());
+        std::cout << ITERATIONS << " vectors of 6 ints: vector " << vector_ms << "ms, small_vector<int, 8> "
+                  << small_ms << "ms" << std::endl;
+    }
+
+}// namespace
@@ -1,5 +1,45 @@
+#include "malloc_allocator.h"
+#include "mmap_allocator.h"
 #include "vector.h"
+#include <chrono>
+#include <cmath>
 #include <gtest/gtest.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+#include <list>
+#include <memory>
+#include <ranges>
+#include <sstream>
+#include <vector>
+
+struct Handle {
+    std::unique_ptr<int> value;
+};
+
+struct UnmarkedHandle {
+    std::unique_ptr<int> value;
+};
+
+template<typename T>
+struct CountingAllocator {
+    using value_type = T;
+    static inline int allocations = 0;
+
+    CountingAllocator() = default;
+    template<typename U>
+    CountingAllocator(const CountingAllocator<U> &) {}
+
+    T *allocate(size_t n) {
+        ++allocations;
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *p, size_t n) { std::allocator<T>().deallocate(p, n); }
+    bool operator==(const CountingAllocator &) const = default;
+};
+
+template<>
+struct userDefineDataStructure::is_trivially_relocatable<Handle> : std::true_type {};
 
 class VectorTest : public ::testing::Test {
 protected:
@@ -181,4 +221,347 @@ TEST_F(VectorTest, LargeNumberOfElements) {
         int_vec.push_back(static_cast<int>(i));
     EXPECT_EQ(int_vec.size(), large_size);
     EXPECT_EQ(int_vec[large_size - 1], static_cast<int>(large_size - 1));
-}
\ No newline at end of file
+}
+TEST_F(VectorTest, TriviallyRelocatableGrowth) {
+    static_assert(userDefineDataStructure::is_trivially_relocatable_v<int>);
+    static_assert(!userDefineDataStructure::is_trivially_relocatable_v<std::string>);
+    static_assert(userDefineDataStructure::is_trivially_relocatable_v<Handle>);
+
+    userDefineDataStructure::vector<Handle> handles;
+    for (int i = 0; i < 1000; ++i)
+        handles.push_back(Handle{std::make_unique<int>(i)});
+    for (int i = 0; i < 1000; ++i)
+        EXPECT_EQ(*handles[i].value, i);
+    handles.resize(10);
+    handles.reserve(5000);
+    EXPECT_EQ(*handles[9].value, 9);
+
+    // Strings with small buffers point into themselves and must be moved one by one.
+    for (int i = 0; i < 1000; ++i)
+        string_vec.push_back(std::to_string(i));
+    for (int i = 0; i < 1000; ++i)
+        EXPECT_EQ(string_vec[i], std::to_string(i));
+}
+
+TEST_F(VectorTest, RelocationPerformance) {
+    const int NUM_ELEMENTS = 4000000;
+    auto run = [&](auto &vec, auto &&make) {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int round = 0; round < 5; ++round) {
+            vec = std::remove_cvref_t<decltype(vec)>();
+            for (int i = 0; i < NUM_ELEMENTS; ++i)
+                vec.push_back(make(i));
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+    };
+
+    userDefineDataStructure::vector<Handle> marked;
+    userDefineDataStructure::vector<UnmarkedHandle> unmarked;
+    auto marked_ms = run(marked, [](int) { return Handle{}; });
+    auto unmarked_ms = run(unmarked, [](int) { return UnmarkedHandle{}; });
+    auto int_ms = run(int_vec, [](int i) { return i; });
+    std::cout << NUM_ELEMENTS << " push_backs x5, unique_ptr holder: relocatable " << marked_ms
+              << "ms, element-wise " << unmarked_ms << "ms; int " << int_ms << "ms" << std::endl;
+}
+
+TEST_F(VectorTest, MmapAllocatorGrowth) {
+    using userDefineDataStructure::MmapAllocator;
+    userDefineDataStructure::vector<uint64_t, MmapAllocator<uint64_t>> column;
+    const size_t count = 4 * MmapAllocator<uint64_t>::kMmapThreshold / sizeof(uint64_t) + 3;
+    for (size_t i = 0; i < count; ++i)
+        column.push_back(i * 7);
+    EXPECT_EQ(column.size(), count);
+    for (size_t i = 0; i < count; ++i)
+        ASSERT_EQ(column[i], i * 7);
+    column.resize(10);
+    column.reserve(count * 2);
+    EXPECT_EQ(column[9], 63);
+
+    // Elements that are not trivially relocatable are moved one by one.
+    userDefineDataStructure::vector<std::string, MmapAllocator<std::string>> names;
+    for (int i = 0; i < 100000; ++i)
+        names.push_back(std::to_string(i));
+    for (int i = 0; i < 100000; ++i)
+        ASSERT_EQ(names[i], std::to_string(i));
+}
+
+TEST_F(VectorTest, MmapGrowthPerformance) {
+    const size_t FINAL_SIZE = size_t(1) << 25;// 256 MiB of uint64_t
+    auto run = [&](auto &vec) {
+        auto start = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < FINAL_SIZE; ++i)
+            vec.push_back(i);
+        auto end = std::chrono::high_resolution_clock::now();
+        EXPECT_EQ(vec[FINAL_SIZE - 1], FINAL_SIZE - 1);
+        return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+    };
+
+    long heap_ms, mmap_ms;
+    {
+        userDefineDataStructure::vector<uint64_t> heap;
+        heap_ms = run(heap);
+    }
+    {
+        userDefineDataStructure::vector<uint64_t, userDefineDataStructure::MmapAllocator<uint64_t>> mapped;
+        mmap_ms = run(mapped);
+    }
+    std::cout << FINAL_SIZE << " push_backs of uint64_t: std::allocator " << heap_ms << "ms, mremap growth "
+              << mmap_ms << "ms" << std::endl;
+}
+
+TEST_F(VectorTest, AssignRange) {
+    std::list<int> source;
+    for (int i = 0; i < 1000; ++i)
+        source.push_back(i);
+
+    using CountedVector = userDefineDataStructure::vector<int, CountingAllocator<int>>;
+    CountingAllocator<int>::allocations = 0;
+    CountedVector counted(source.begin(), source.end());
+    EXPECT_EQ(CountingAllocator<int>::allocations, 1);
+    EXPECT_EQ(counted.capacity(), 1000);
+    EXPECT_EQ(counted[999], 999);
+
+    counted.assign(source.begin(), std::next(source.begin(), 10));
+    EXPECT_EQ(counted.size(), 10);
+    counted.assign(source.begin(), std::next(source.begin(), 500));
+    EXPECT_EQ(counted.size(), 500);
+    EXPECT_EQ(counted[499], 499);
+    EXPECT_EQ(CountingAllocator<int>::allocations, 1);
+
+    std::istringstream input("1 2 3 4 5");
+    int_vec.assign(std::istream_iterator<int>(input), std::istream_iterator<int>());
+    EXPECT_EQ(int_vec.size(), 5);
+    EXPECT_EQ(int_vec.back(), 5);
+
+    int_vec.assign(3, 7);
+    EXPECT_EQ(int_vec.size(), 3);
+    EXPECT_EQ(int_vec[2], 7);
+
+    std::vector<std::string> words = {"a", "b", "c"};
+    string_vec = {"x", "y", "z", "w", "v"};
+    string_vec.assign(words.begin(), words.end());
+    EXPECT_EQ(string_vec.size(), 3);
+    EXPECT_EQ(string_vec[2], "c");
+}
+
+TEST_F(VectorTest, InsertRange) {
+    auto expect = [](const auto &vec, std::vector<std::string> expected) {
+        ASSERT_EQ(vec.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i)
+            EXPECT_EQ(vec[i], expected[i]);
+    };
+    std::vector<std::string> two = {"x", "y"};
+    std::vector<std::string> four = {"p", "q", "r", "s"};
+
+    string_vec = {"a", "b", "c", "d", "e"};
+    string_vec.reserve(20);
+    // Fewer new elements than elements after pos, then more.
+    auto it = string_vec.insert(string_vec.begin() + 1, two.begin(), two.end());
+    EXPECT_EQ(*it, "x");
+    expect(string_vec, {"a", "x", "y", "b", "c", "d", "e"});
+    string_vec.insert(string_vec.end() - 2, four.begin(), four.end());
+    expect(string_vec, {"a", "x", "y", "b", "c", "p", "q", "r", "s", "d", "e"});
+    string_vec.insert(string_vec.end(), two.begin(), two.end());
+    string_vec.insert(string_vec.begin(), two.begin(), two.begin());
+    expect(string_vec, {"a", "x", "y", "b", "c", "p", "q", "r", "s", "d", "e", "x", "y"});
+
+    // Reallocating insert.
+    userDefineDataStructure::vector<std::string> small = {"a", "b"};
+    small.insert(small.begin() + 1, four.begin(), four.end());
+    expect(small, {"a", "p", "q", "r", "s", "b"});
+
+    std::istringstream input("7 8 9");
+    int_vec = {1, 2, 3};
+    int_vec.insert(int_vec.begin() + 1, std::istream_iterator<int>(input), std::istream_iterator<int>());
+    std::vector<int> expected = {1, 7, 8, 9, 2, 3};
+    EXPECT_TRUE(std::equal(int_vec.begin(), int_vec.end(), expected.begin(), expected.end()));
+
+    using CountedVector = userDefineDataStructure::vector<int, CountingAllocator<int>>;
+    std::list<int> source(10000, 1);
+    CountedVector counted = {1, 2, 3};
+    CountingAllocator<int>::allocations = 0;
+    counted.insert(counted.begin() + 1, source.begin(), source.end());
+    EXPECT_EQ(CountingAllocator<int>::allocations, 1);
+    EXPECT_EQ(counted.size(), 10003);
+    EXPECT_EQ(counted[10002], 3);
+}
+
+TEST_F(VectorTest, EraseRange) {
+    string_vec = {"a", "b", "c", "d", "e"};
+    auto it = string_vec.erase(string_vec.begin() + 1, string_vec.begin() + 3);
+    EXPECT_EQ(*it, "d");
+    EXPECT_EQ(string_vec.size(), 3);
+    it = string_vec.erase(string_vec.begin());
+    EXPECT_EQ(*it, "d");
+    it = string_vec.erase(string_vec.begin(), string_vec.begin());
+    EXPECT_EQ(*it, "d");
+    it = string_vec.erase(string_vec.begin(), string_vec.end());
+    EXPECT_EQ(it, string_vec.end());
+    EXPECT_TRUE(string_vec.empty());
+}
+
+TEST_F(VectorTest, EmplaceBack) {
+    userDefineDataStructure::vector<std::pair<int, std::string>> pairs;
+    auto &first = pairs.emplace_back(1, "one");
+    EXPECT_EQ(first.second, "one");
+
+    // The argument refers to an element that moves when the vector grows.
+    string_vec.push_back(std::string(100, 'x'));
+    for (int i = 0; i < 100; ++i)
+        string_vec.emplace_back(string_vec[0]);
+    for (const auto &value: string_vec)
+        EXPECT_EQ(value, std::string(100, 'x'));
+}
+
+TEST_F(VectorTest, AppendRange) {
+    std::vector<int> contiguous = {1, 2, 3};
+    std::list<int> linked = {4, 5};
+    int_vec.append_range(contiguous);
+    int_vec.append_range(linked);
+    int_vec.append_range(std::views::iota(6, 9));
+    std::istringstream input("9 10");
+    int_vec.append_range(std::views::istream<int>(input));
+    ASSERT_EQ(int_vec.size(), 10);
+    for (int i = 0; i < 10; ++i)
+        EXPECT_EQ(int_vec[i], i + 1);
+
+    using CountedVector = userDefineDataStructure::vector<int, CountingAllocator<int>>;
+    CountedVector counted;
+    CountingAllocator<int>::allocations = 0;
+    counted.append_range(std::views::iota(0, 100000) | std::views::transform([](int i) { return i * 2; }));
+    EXPECT_EQ(CountingAllocator<int>::allocations, 1);
+    EXPECT_EQ(counted[99999], 199998);
+}
+
+TEST_F(VectorTest, BulkLoadPerformance) {
+    const int NUM_ELEMENTS = 10000000;
+    std::vector<int> source(NUM_ELEMENTS);
+    for (int i = 0; i < NUM_ELEMENTS; ++i)
+        source[i] = i;
+
+    auto time = [](auto &&load) {
+        auto start = std::chrono::high_resolution_clock::now();
+        load();
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+    };
+
+    userDefineDataStructure::vector<int> pushed, assigned, appended;
+    auto push_ms = time([&] {
+        for (int value: source)
+            pushed.push_back(value);
+    });
+    auto assign_ms = time([&] { assigned.assign(source.begin(), source.end()); });
+    auto append_ms = time([&] { appended.append_range(source); });
+    EXPECT_EQ(assigned.size(), source.size());
+    EXPECT_EQ(appended[NUM_ELEMENTS - 1], NUM_ELEMENTS - 1);
+    std::cout << NUM_ELEMENTS << " ints: push_back loop " << push_ms << "ms, assign " << assign_ms
+              << "ms, append_range " << append_ms << "ms" << std::endl;
+}
+
+TEST_F(VectorTest, GrowthPolicies) {
+    using namespace userDefineDataStructure;
+    EXPECT_EQ(DoublingGrowthPolicy::capacity(10, 11, 4), 20);
+    EXPECT_EQ(DoublingGrowthPolicy::capacity(0, 1, 4), 1);
+    EXPECT_EQ(HalfGrowthPolicy::capacity(10, 11, 4), 15);
+    EXPECT_EQ(ChunkGrowthPolicy<64>::capacity(64, 65, 4), 128);
+    EXPECT_EQ(ChunkGrowthPolicy<64>::capacity(64, 300, 4), 320);
+    EXPECT_EQ(PageGrowthPolicy::capacity(0, 1, 8), 512);
+    EXPECT_EQ(PageGrowthPolicy::capacity(512, 513, 8), 1024);
+
+    // The policy's own size-class grid.
+    static_assert(SizeClassGrowthPolicy::size_class(1) == 16);
+    static_assert(SizeClassGrowthPolicy::size_class(100) == 112);
+    static_assert(SizeClassGrowthPolicy::size_class(129) == 160);
+    static_assert(SizeClassGrowthPolicy::size_class(400) == 448);
+    static_assert(SizeClassGrowthPolicy::size_class(512) == 512);
+    static_assert(SizeClassGrowthPolicy::size_class(100000) == 102400);
+    EXPECT_EQ(SizeClassGrowthPolicy::capacity(0, 1, 4), 4);
+    EXPECT_EQ(SizeClassGrowthPolicy::capacity(100, 101, 4), 160);
+    EXPECT_EQ(SizeClassGrowthPolicy::capacity(0, 1, 24), 1);
+
+    auto fill = [](auto &vec) {
+        for (int i = 0; i < 10000; ++i)
+            vec.push_back(std::to_string(i));
+        for (int i = 0; i < 10000; ++i)
+            ASSERT_EQ(vec[i], std::to_string(i));
+    };
+    vector<std::string, std::allocator<std::string>, DoublingGrowthPolicy> doubling;
+    vector<std::string, std::allocator<std::string>, HalfGrowthPolicy> half;
+    vector<std::string, std::allocator<std::string>, ChunkGrowthPolicy<100>> chunk;
+    vector<std::string, std::allocator<std::string>, PageGrowthPolicy> page;
+    vector<std::string, std::allocator<std::string>, SizeClassGrowthPolicy> size_class;
+    fill(doubling);
+    fill(half);
+    fill(chunk);
+    fill(page);
+    fill(size_class);
+    fill(string_vec);
+    EXPECT_EQ(chunk.capacity(), 10000);
+}
+
+TEST_F(VectorTest, AllocateAtLeastSetsCapacity) {
+    userDefineDataStructure::vector<int, userDefineDataStructure::MallocAllocator<int>> ids;
+    userDefineDataStructure::vector<std::string, userDefineDataStructure::MallocAllocator<std::string>> names;
+    for (int i = 0; i < 10000; ++i) {
+        ids.push_back(i);
+        names.push_back(std::to_string(i));
+#if defined(__GLIBC__)
+        // capacity() covers every whole element of the block malloc returned.
+        ASSERT_EQ(ids.capacity(), malloc_usable_size(ids.data()) / sizeof(int));
+#endif
+    }
+    for (int i = 0; i < 10000; ++i) {
+        ASSERT_EQ(ids[i], i);
+        ASSERT_EQ(names[i], std::to_string(i));
+    }
+    std::list<int> source(1000, 3);
+    ids.assign(source.begin(), source.end());
+    ids.insert(ids.begin(), source.begin(), source.end());
+    ids.assign(100000, 1);
+    EXPECT_EQ(ids.size(), 100000);
+    EXPECT_GE(ids.capacity(), 100000);
+}
+
+TEST_F(VectorTest, GrowthPolicyMemoryOverhead) {
+    // Grow vectors of 1 to 1M ints by push_back and compare what each policy
+    // leaves unused: capacity beyond size, and bytes malloc handed out beyond capacity.
+    auto measure = [](auto tag, const char *name) {
+        using Vector = decltype(tag);
+        double unused_capacity = 0, malloc_slack = 0;
+        size_t reallocations = 0, samples = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (double n = 1; n <= 1000000; n *= 1.05, ++samples) {
+            Vector vec;
+            const int *data = nullptr;
+            for (int i = 0; i < static_cast<int>(n); ++i) {
+                vec.push_back(i);
+                reallocations += vec.data() != data;
+                data = vec.data();
+            }
+            size_t capacity_bytes = vec.capacity() * sizeof(int);
+            unused_capacity += 1.0 - static_cast<double>(vec.size()) / vec.capacity();
+#if defined(__GLIBC__)
+            malloc_slack += static_cast<double>(malloc_usable_size(vec.data()) - capacity_bytes);
+#else
+            (void) capacity_bytes;
+#endif
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << "  " << name << ": unused capacity " << std::round(1000 * unused_capacity / samples) / 10
+                  << "%, malloc slack " << std::round(malloc_slack / samples) << " B, " << reallocations
+                  << " reallocations, " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
+                  << "ms" << std::endl;
+    };
+
+    using namespace userDefineDataStructure;
+    std::cout << "Average over vector<int> sizes from 1 to 1M (5% steps):" << std::endl;
+    measure(vector<int, std::allocator<int>, DoublingGrowthPolicy>(), "2x");
+    measure(vector<int, std::allocator<int>, HalfGrowthPolicy>(), "1.5x");
+    measure(vector<int, std::allocator<int>, ChunkGrowthPolicy<4096>>(), "4096-element chunks");
+    measure(vector<int, std::allocator<int>, PageGrowthPolicy>(), "2x page-rounded");
+    measure(vector<int, std::allocator<int>, SizeClassGrowthPolicy>(), "1.5x size-class grid");
+    measure(vector<int>(), "1.5x (default)");
+    measure(vector<int, MallocAllocator<int>>(), "1.5x, MallocAllocator::allocate_at_least");
+}